@@ -1,6 +1,7 @@
 import QtQuick
 import QtQuick.Controls
 import QtQuick.Controls.Material
+import QtQuick.Dialogs
 import QtQuick.Layouts
 import GstInspect
 
@@ -49,16 +50,52 @@ ApplicationWindow {
                 TextField {
                     id: searchField
                     Layout.fillWidth: true
-                    placeholderText: "Search elements..."
+                    // Indexed by GstElementBrowser.SearchMode
+                    placeholderText: ["Search elements...", "e.g. latency, flag:controllable type:bool",
+                        "e.g. sink video/x-raw(memory:DMABuf), format=NV12"][elementBrowser.searchMode]
                     onTextChanged: elementBrowser.filterElements(text)
                 }
 
-                // Refresh button
+                ComboBox {
+                    Layout.fillWidth: true
+                    // Entries in the order of GstElementBrowser.SearchMode
+                    model: ["Search elements", "Search properties", "Search caps"]
+                    currentIndex: elementBrowser.searchMode
+                    onActivated: index => elementBrowser.searchMode = index
+                }
+
+                // Refresh re-inspects only the plugins that changed since the cache was written
+                RowLayout {
+                    Layout.fillWidth: true
+
+                    Button {
+                        Layout.fillWidth: true
+                        text: elementBrowser.isLoading ? "Cancel loading" : "Refresh Elements"
+                        onClicked: elementBrowser.isLoading ? elementBrowser.cancelRefresh(
+                                                                  ) : elementBrowser.refreshElements()
+                    }
+
+                    // Ignores the cache and inspects every plugin again
+                    Button {
+                        text: "Full Rescan"
+                        enabled: !elementBrowser.isLoading
+                        onClicked: elementBrowser.refreshElements(true)
+                    }
+                }
+
                 Button {
                     Layout.fillWidth: true
-                    text: elementBrowser.isLoading ? "Loading..." : "Refresh Elements"
-                    enabled: !elementBrowser.isLoading
-                    onClicked: elementBrowser.refreshElements()
+                    text: "Compare Catalogs..."
+                    onClicked: compareDialog.open()
+                }
+
+                ProgressBar {
+                    Layout.fillWidth: true
+                    visible: elementBrowser.isLoading
+                    indeterminate: elementBrowser.expectedCount <= 0
+                    from: 0
+                    to: Math.max(elementBrowser.expectedCount, 1)
+                    value: elementBrowser.loadedCount
                 }
 
                 // Element list
@@ -67,33 +104,51 @@ ApplicationWindow {
                     Layout.fillWidth: true
                     Layout.fillHeight: true
 
-                    model: elementBrowser.elementNames
+                    model: elementBrowser.elementModel
                     currentIndex: -1
+                    reuseItems: true
 
                     delegate: ItemDelegate {
                         id: delegate
                         width: elementList.width
                         height: 40
-                        required property string modelData
+                        required property string name
+                        required property string longName
+                        required property var matchDetails
                         required property int index
                         Rectangle {
                             anchors.fill: parent
-                            color: parent.hovered ? "#e3f2fd" : (delegate.modelData.selectedElement === modelData ? "#bbdefb" : "transparent")
-                            border.color: delegate.modelData.selectedElement
-                                          === delegate.modelData ? "#2196f3" : "transparent"
+                            color: parent.hovered ? "#e3f2fd" : (elementBrowser.selectedElement === delegate.name ? "#bbdefb" : "transparent")
+                            border.color: elementBrowser.selectedElement
+                                          === delegate.name ? "#2196f3" : "transparent"
 
                             Text {
+                                id: nameText
                                 anchors.left: parent.left
                                 anchors.leftMargin: 10
                                 anchors.verticalCenter: parent.verticalCenter
-                                text: delegate.modelData
+                                text: delegate.name
                                 font.family: "monospace"
                             }
+
+                            Text {
+                                anchors.left: nameText.right
+                                anchors.leftMargin: 8
+                                anchors.right: parent.right
+                                anchors.rightMargin: 10
+                                anchors.verticalCenter: parent.verticalCenter
+                                // In property and caps search, show what matched instead of the long name
+                                text: delegate.matchDetails.length > 0 ? delegate.matchDetails.join(", ")
+                                                                       : delegate.longName
+                                elide: Text.ElideRight
+                                color: "#666"
+                                font.pointSize: 8
+                            }
                         }
 
                         onClicked: {
-                            modelData.selectedElement = delegate.modelData
-                            modelData.currentIndex = delegate.index
+                            elementBrowser.selectedElement = delegate.name
+                            elementList.currentIndex = delegate.index
                         }
                     }
 
@@ -103,7 +158,7 @@ ApplicationWindow {
                 // Status
                 Text {
                     Layout.fillWidth: true
-                    text: `${elementBrowser.elementNames.length} elements available`
+                    text: elementBrowser.isLoading ? `${elementBrowser.loadedCount} elements parsed...` : `${elementList.count} elements available`
                     color: "#666"
                     font.pointSize: 9
                 }
@@ -185,10 +240,42 @@ ApplicationWindow {
                                     color: "#666"
                                 }
                             }
+
+                            RowLayout {
+                                visible: elementBrowser.elementPlugin.length > 0
+
+                                Text {
+                                    text: "Plugin:"
+                                    font.bold: true
+                                    font.pointSize: 9
+                                }
+
+                                Text {
+                                    text: elementBrowser.elementPlugin
+                                    font.pointSize: 9
+                                    color: "#666"
+                                }
+                            }
+
+                            RowLayout {
+                                visible: elementBrowser.elementUriHandling.length > 0
+
+                                Text {
+                                    text: "URI handling:"
+                                    font.bold: true
+                                    font.pointSize: 9
+                                }
+
+                                Text {
+                                    text: elementBrowser.elementUriHandling
+                                    font.pointSize: 9
+                                    color: "#666"
+                                }
+                            }
                         }
                     }
 
-                    // Tabs for Properties and Pads
+                    // Tabs for Properties, Pads, Signals and Links
                     TabBar {
                         id: tabBar
                         Layout.fillWidth: true
@@ -201,6 +288,13 @@ ApplicationWindow {
                             text: `Pad Templates (${elementBrowser.padModel.rowCount(
                                       )})`
                         }
+                        TabButton {
+                            text: `Signals (${elementBrowser.signalModel.rowCount(
+                                      )})`
+                        }
+                        TabButton {
+                            text: "Links"
+                        }
                     }
 
                     StackLayout {
@@ -468,9 +562,391 @@ ApplicationWindow {
                                 ScrollBar.vertical: ScrollBar {}
                             }
                         }
+
+                        // Signals tab
+                        Item {
+                            ListView {
+                                id: signalList
+                                anchors.fill: parent
+                                model: elementBrowser.signalModel
+                                spacing: 1
+
+                                delegate: Rectangle {
+                                    id: signalDelegate
+                                    required property int index
+                                    required property string name
+                                    required property string kind
+                                    required property string returnType
+                                    required property var argumentTypes
+                                    width: signalList.width
+                                    height: signalRow.height + 20
+                                    color: signalDelegate.index % 2 == 0 ? "#fafafa" : "white"
+                                    border.color: "#eee"
+
+                                    RowLayout {
+                                        id: signalRow
+                                        anchors.left: parent.left
+                                        anchors.right: parent.right
+                                        anchors.top: parent.top
+                                        anchors.margins: 10
+                                        spacing: 8
+
+                                        Rectangle {
+                                            width: kindText.width + 12
+                                            height: kindText.height + 6
+                                            color: signalDelegate.kind
+                                                   === "action" ? "#6f42c1" : "#17a2b8"
+                                            radius: 3
+
+                                            Text {
+                                                id: kindText
+                                                anchors.centerIn: parent
+                                                text: signalDelegate.kind
+                                                color: "white"
+                                                font.bold: true
+                                                font.pointSize: 8
+                                            }
+                                        }
+
+                                        Text {
+                                            text: signalDelegate.name
+                                            font.bold: true
+                                            font.family: "monospace"
+                                            color: "#d73a49"
+                                        }
+
+                                        Text {
+                                            text: `${signalDelegate.returnType} (${signalDelegate.argumentTypes.join(
+                                                      ", ")})`
+                                            font.family: "monospace"
+                                            font.pointSize: 9
+                                            color: "#6f42c1"
+                                            elide: Text.ElideRight
+                                            Layout.fillWidth: true
+                                        }
+                                    }
+                                }
+
+                                Text {
+                                    anchors.centerIn: parent
+                                    visible: signalList.count === 0
+                                    text: "No signals"
+                                    color: "#999"
+                                }
+
+                                ScrollBar.vertical: ScrollBar {}
+                            }
+                        }
+
+                        // Links tab
+                        Item {
+                            id: linksTab
+                            property int graphRevision: 0
+                            // Only asked while the tab is shown, so the graph is not built for other tabs
+                            property var downstream: {
+                                linksTab.graphRevision
+                                return linksTab.visible ? elementBrowser.downstreamElements(
+                                                              elementBrowser.selectedElement) : []
+                            }
+                            property var autoplugPath: []
+                            property bool autoplugSearched: false
+
+                            Connections {
+                                target: elementBrowser
+                                function onCompatibilityGraphChanged() {
+                                    linksTab.graphRevision++
+                                }
+                                function onSelectedElementChanged() {
+                                    linksTab.autoplugPath = []
+                                    linksTab.autoplugSearched = false
+                                }
+                            }
+
+                            ColumnLayout {
+                                anchors.fill: parent
+                                spacing: 8
+
+                                RowLayout {
+                                    Layout.fillWidth: true
+
+                                    TextField {
+                                        id: autoplugSinkField
+                                        Layout.fillWidth: true
+                                        placeholderText: "Sink element, e.g. autovideosink"
+                                        onAccepted: autoplugButton.clicked()
+                                    }
+
+                                    Button {
+                                        id: autoplugButton
+                                        text: "Autoplug"
+                                        enabled: elementBrowser.selectedElement.length > 0
+                                                 && autoplugSinkField.text.length > 0
+                                        onClicked: {
+                                            linksTab.autoplugPath = elementBrowser.autoplugPath(
+                                                        elementBrowser.selectedElement,
+                                                        autoplugSinkField.text.trim())
+                                            linksTab.autoplugSearched = true
+                                        }
+                                    }
+                                }
+
+                                Text {
+                                    Layout.fillWidth: true
+                                    visible: linksTab.autoplugSearched
+                                    text: linksTab.autoplugPath.length > 0 ? linksTab.autoplugPath.join(
+                                                                                 " ! ") : "No chain found"
+                                    font.family: "monospace"
+                                    font.pointSize: 10
+                                    wrapMode: Text.WordWrap
+                                    color: linksTab.autoplugPath.length > 0 ? "#000" : "#999"
+                                }
+
+                                Text {
+                                    text: `Can be followed by (${linksTab.downstream.length})`
+                                    font.bold: true
+                                    font.pointSize: 9
+                                }
+
+                                ListView {
+                                    id: downstreamList
+                                    Layout.fillWidth: true
+                                    Layout.fillHeight: true
+                                    clip: true
+                                    model: linksTab.downstream
+
+                                    delegate: ItemDelegate {
+                                        required property string modelData
+                                        width: downstreamList.width
+                                        text: modelData
+                                        onClicked: elementBrowser.selectedElement = modelData
+                                    }
+
+                                    ScrollBar.vertical: ScrollBar {}
+                                }
+                            }
+                        }
                     }
                 }
             }
         }
     }
+
+    // Catalog comparison - differences between two dumps or recorded outputs
+    Dialog {
+        id: compareDialog
+        title: "Compare Catalogs"
+        anchors.centerIn: parent
+        width: Math.min(root.width - 80, 900)
+        height: root.height - 80
+        modal: true
+        standardButtons: Dialog.Close
+
+        property url beforeFile
+        property url afterFile
+        property string errorMessage
+        property bool compared: false
+
+        Connections {
+            target: elementBrowser
+            function onComparisonFailed(errorMessage) {
+                compareDialog.errorMessage = errorMessage
+            }
+        }
+
+        FileDialog {
+            id: catalogFileDialog
+            property bool selectingBefore: true
+            title: "Select a catalog dump or recorded gst-inspect-1.0 output"
+            nameFilters: ["Catalogs (*.json *.cbor *.txt)", "All files (*)"]
+            onAccepted: {
+                if (selectingBefore) {
+                    compareDialog.beforeFile = selectedFile
+                } else {
+                    compareDialog.afterFile = selectedFile
+                }
+            }
+        }
+
+        ColumnLayout {
+            anchors.fill: parent
+            spacing: 8
+
+            Repeater {
+                model: [{
+                        "label": "Before",
+                        "before": true
+                    }, {
+                        "label": "After",
+                        "before": false
+                    }]
+
+                delegate: RowLayout {
+                    id: catalogRow
+                    required property var modelData
+                    readonly property url file: modelData.before ? compareDialog.beforeFile : compareDialog.afterFile
+                    Layout.fillWidth: true
+
+                    Text {
+                        text: catalogRow.modelData.label
+                        font.bold: true
+                        Layout.preferredWidth: 60
+                    }
+
+                    Text {
+                        Layout.fillWidth: true
+                        text: catalogRow.file.toString().length > 0 ? catalogRow.file.toString(
+                                                                          ) : "Current catalog"
+                        elide: Text.ElideMiddle
+                        font.family: "monospace"
+                        color: catalogRow.file.toString().length > 0 ? "#000" : "#999"
+                    }
+
+                    Button {
+                        text: "Browse..."
+                        onClicked: {
+                            catalogFileDialog.selectingBefore = catalogRow.modelData.before
+                            catalogFileDialog.open()
+                        }
+                    }
+
+                    Button {
+                        text: "Current"
+                        enabled: catalogRow.file.toString().length > 0
+                        onClicked: {
+                            if (catalogRow.modelData.before) {
+                                compareDialog.beforeFile = ""
+                            } else {
+                                compareDialog.afterFile = ""
+                            }
+                        }
+                    }
+                }
+            }
+
+            RowLayout {
+                Layout.fillWidth: true
+
+                Button {
+                    text: "Compare"
+                    enabled: !elementBrowser.isComparing
+                    onClicked: {
+                        compareDialog.errorMessage = ""
+                        compareDialog.compared = true
+                        elementBrowser.compareCatalogs(compareDialog.beforeFile,
+                                                       compareDialog.afterFile)
+                    }
+                }
+
+                BusyIndicator {
+                    visible: elementBrowser.isComparing
+                    running: visible
+                    Layout.preferredHeight: 32
+                }
+
+                Text {
+                    Layout.fillWidth: true
+                    text: {
+                        if (compareDialog.errorMessage.length > 0)
+                            return compareDialog.errorMessage
+                        if (compareDialog.compared && !elementBrowser.isComparing)
+                            return `${changeList.count} changes`
+                        return ""
+                    }
+                    color: compareDialog.errorMessage.length > 0 ? "#dc3545" : "#666"
+                    elide: Text.ElideRight
+                }
+            }
+
+            ListView {
+                id: changeList
+                Layout.fillWidth: true
+                Layout.fillHeight: true
+                clip: true
+                model: elementBrowser.catalogDiffModel
+                spacing: 1
+
+                delegate: Rectangle {
+                    id: changeDelegate
+                    required property int index
+                    required property string kind
+                    required property string element
+                    required property string item
+                    required property string oldValue
+                    required property string newValue
+                    width: changeList.width
+                    height: changeColumn.height + 12
+                    color: changeDelegate.index % 2 == 0 ? "#fafafa" : "white"
+                    border.color: "#eee"
+
+                    ColumnLayout {
+                        id: changeColumn
+                        anchors.left: parent.left
+                        anchors.right: parent.right
+                        anchors.top: parent.top
+                        anchors.margins: 6
+                        spacing: 2
+
+                        RowLayout {
+                            spacing: 8
+
+                            Rectangle {
+                                width: changeKindText.width + 12
+                                height: changeKindText.height + 6
+                                color: changeDelegate.kind.endsWith(
+                                           "added") ? "#28a745" : (changeDelegate.kind.endsWith(
+                                                                       "removed") ? "#dc3545" : "#fd7e14")
+                                radius: 3
+
+                                Text {
+                                    id: changeKindText
+                                    anchors.centerIn: parent
+                                    text: changeDelegate.kind
+                                    color: "white"
+                                    font.bold: true
+                                    font.pointSize: 8
+                                }
+                            }
+
+                            Text {
+                                text: changeDelegate.item.length
+                                      > 0 ? `${changeDelegate.element}.${changeDelegate.item}` : changeDelegate.element
+                                font.bold: true
+                                font.family: "monospace"
+                            }
+                        }
+
+                        Text {
+                            Layout.fillWidth: true
+                            visible: changeDelegate.oldValue.length > 0
+                            text: `- ${changeDelegate.oldValue}`
+                            font.family: "monospace"
+                            font.pointSize: 9
+                            color: "#dc3545"
+                            wrapMode: Text.WrapAnywhere
+                        }
+
+                        Text {
+                            Layout.fillWidth: true
+                            visible: changeDelegate.newValue.length > 0
+                            text: `+ ${changeDelegate.newValue}`
+                            font.family: "monospace"
+                            font.pointSize: 9
+                            color: "#28a745"
+                            wrapMode: Text.WrapAnywhere
+                        }
+                    }
+                }
+
+                Text {
+                    anchors.centerIn: parent
+                    visible: compareDialog.compared && !elementBrowser.isComparing
+                             && changeList.count === 0 && compareDialog.errorMessage.length === 0
+                    text: "The catalogs match"
+                    color: "#999"
+                }
+
+                ScrollBar.vertical: ScrollBar {}
+            }
+        }
+    }
 }
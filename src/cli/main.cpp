@@ -0,0 +1,141 @@
+#include "gstcatalogwriter.h"
+#include "gstinspectparser.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QSaveFile>
+#include <QTextStream>
+#include <memory>
+
+using namespace GstStudio;
+
+namespace {
+
+/// Exit codes, distinct per failure so batch jobs can tell them apart
+constexpr int kExitUsage = 2;
+constexpr int kExitDiscovery = 3;
+constexpr int kExitOutput = 4;
+
+int fail(int code, const QString& message) {
+    QTextStream(stderr) << QCoreApplication::applicationName() << ": " << message << Qt::endl;
+    return code;
+}
+
+/// Write every element of the catalog, materializing one element at a time
+bool writeCatalog(GstInspectParser& parser, QIODevice* device, GstCatalogWriter::Format format) {
+    GstCatalogWriter writer(device, format);
+    for (const QString& name : parser.getAllElementNames()) {
+        writer.writeElement(parser.getElement(name));
+    }
+    return writer.finish();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("gststudio-catalog"));
+
+    QCommandLineParser options;
+    options.setApplicationDescription(QStringLiteral("Write the GStreamer element catalog as JSON or CBOR."));
+    options.addHelpOption();
+    const QCommandLineOption formatOption(QStringLiteral("format"), QStringLiteral("Output format: json or cbor."),
+                                          QStringLiteral("format"), QStringLiteral("json"));
+    const QCommandLineOption outputOption({QStringLiteral("o"), QStringLiteral("output")},
+                                          QStringLiteral("Write to <file> instead of standard output."),
+                                          QStringLiteral("file"));
+    const QCommandLineOption inputOption(
+        {QStringLiteral("i"), QStringLiteral("input")},
+        QStringLiteral("Read recorded gst-inspect-1.0 --print-all output from <file>, - for standard input, "
+                       "instead of inspecting the local installation."),
+        QStringLiteral("file"));
+    const QCommandLineOption noCacheOption(QStringLiteral("no-cache"),
+                                           QStringLiteral("Inspect all plugins even if the cache is current."));
+    const QCommandLineOption perPluginOption(
+        QStringLiteral("per-plugin"),
+        QStringLiteral("Inspect plugins and elements in concurrent gst-inspect-1.0 processes instead of a single "
+                       "--print-all run; an inspection exceeding the timeout only loses its own elements."));
+    const QCommandLineOption timeoutOption(QStringLiteral("timeout"),
+                                           QStringLiteral("Kill a single per-plugin inspection after <ms> "
+                                                          "milliseconds, 0 for no limit."),
+                                           QStringLiteral("ms"));
+    options.addOptions({formatOption, outputOption, inputOption, noCacheOption, perPluginOption, timeoutOption});
+    options.process(app);
+
+    GstCatalogWriter::Format format = GstCatalogWriter::Format::Json;
+    if (!GstCatalogWriter::formatFromName(options.value(formatOption), format)) {
+        return fail(kExitUsage, QStringLiteral("unknown format \"%1\"").arg(options.value(formatOption)));
+    }
+
+    GstInspectParser parser;
+    if (options.isSet(perPluginOption)) {
+        parser.setDiscoveryMode(GstInspectParser::DiscoveryMode::PerPlugin);
+    }
+    if (options.isSet(timeoutOption)) {
+        bool valid = false;
+        const int timeout = options.value(timeoutOption).toInt(&valid);
+        if (!valid || timeout < 0) {
+            return fail(kExitUsage, QStringLiteral("invalid timeout \"%1\"").arg(options.value(timeoutOption)));
+        }
+        parser.setInspectTimeout(timeout);
+    }
+
+    if (options.isSet(inputOption)) {
+        const QString inputPath = options.value(inputOption);
+        QFile input(inputPath);
+        const bool opened =
+            inputPath == u"-" ? input.open(stdin, QIODevice::ReadOnly) : input.open(QIODevice::ReadOnly);
+        if (!opened) {
+            return fail(kExitUsage, QStringLiteral("cannot read %1: %2").arg(inputPath, input.errorString()));
+        }
+        parser.loadOutput(input.readAll());
+    } else {
+        // A current cache finishes discovery before parseAllElements() returns, with no event loop running yet
+        bool done = false;
+        QString failure;
+        QObject::connect(&parser, &GstInspectParser::parsingFinished, &app, [&done]() {
+            done = true;
+            QCoreApplication::quit();
+        });
+        QObject::connect(&parser, &GstInspectParser::parsingFailed, &app, [&done, &failure](const QString& message) {
+            done = true;
+            failure = message;
+            QCoreApplication::quit();
+        });
+
+        if (!parser.parseAllElements(!options.isSet(noCacheOption))) {
+            return fail(kExitDiscovery, QStringLiteral("element discovery could not be started"));
+        }
+        if (!done) {
+            QCoreApplication::exec();
+        }
+        if (!failure.isEmpty()) {
+            return fail(kExitDiscovery, failure);
+        }
+    }
+
+    std::unique_ptr<QFileDevice> output;
+    if (options.isSet(outputOption)) {
+        // QSaveFile keeps a previous dump intact if writing fails halfway
+        output = std::make_unique<QSaveFile>(options.value(outputOption));
+        output->open(QIODevice::WriteOnly);
+    } else {
+        auto standardOutput = std::make_unique<QFile>();
+        standardOutput->open(stdout, QIODevice::WriteOnly);
+        output = std::move(standardOutput);
+    }
+    if (!output->isOpen()) {
+        return fail(kExitOutput, QStringLiteral("cannot write %1: %2").arg(output->fileName(), output->errorString()));
+    }
+
+    bool written = writeCatalog(parser, output.get(), format);
+    if (auto* saveFile = qobject_cast<QSaveFile*>(output.get())) {
+        written = written && saveFile->commit();
+    } else {
+        written = written && output->flush();
+    }
+    if (!written) {
+        return fail(kExitOutput, QStringLiteral("writing the catalog failed: %1").arg(output->errorString()));
+    }
+    return 0;
+}
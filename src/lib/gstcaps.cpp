@@ -0,0 +1,367 @@
+#include "gstcaps.h"
+#include <QHashFunctions>
+#include <QStringTokenizer>
+#include <algorithm>
+
+namespace GstStudio {
+
+namespace {
+
+/// Feature implied by structures that do not name one
+constexpr QStringView kSystemMemoryFeature = u"memory:SystemMemory";
+
+bool isMediaTypeChar(QChar c) {
+    return c.isLetterOrNumber() || c == u'-' || c == u'_' || c == u'.' || c == u'+';
+}
+
+void sortFields(QList<GstCapsStructure>& structures) {
+    for (GstCapsStructure& structure : structures) {
+        std::sort(structure.m_fields.begin(), structure.m_fields.end(),
+                  [](const GstCapsField& a, const GstCapsField& b) { return a.m_name < b.m_name; });
+    }
+}
+
+qsizetype bracketBalance(QStringView text) {
+    qsizetype balance = 0;
+    bool quoted = false;
+    for (QChar c : text) {
+        if (c == u'"') {
+            quoted = !quoted;
+        } else if (quoted) {
+            continue;
+        } else if (c == u'{' || c == u'[' || c == u'<' || c == u'(') {
+            ++balance;
+        } else if (c == u'}' || c == u']' || c == u'>' || c == u')') {
+            --balance;
+        }
+    }
+    return balance;
+}
+
+} // namespace
+
+GstCaps GstStudio::GstCaps::parse(QStringView text) {
+    GstCaps caps;
+    if (text.trimmed().isEmpty()) {
+        caps.m_any = true;
+        return caps;
+    }
+
+    GstCapsStructure* current = nullptr;
+    for (QStringView line : qTokenize(text, u'\n')) {
+        line = line.trimmed();
+        if (line.isEmpty()) {
+            continue;
+        }
+
+        if (line == u"ANY") {
+            caps.m_any = true;
+            current = nullptr;
+            continue;
+        }
+        if (line == u"EMPTY") {
+            current = nullptr;
+            continue;
+        }
+
+        // "format: { ... }" is a field of the current structure; media types never contain ": "
+        const qsizetype separator = line.indexOf(u": ");
+        if (separator > 0 && current) {
+            GstCapsField field;
+            field.m_name = line.first(separator).trimmed().toString();
+            field.m_values = parseValue(line.sliced(separator + 2));
+            current->m_fields.append(field);
+            continue;
+        }
+
+        GstCapsStructure structure;
+        if (parseStructureLine(line, structure)) {
+            caps.m_mediaTypeMask |= mediaTypeBit(structure.m_mediaType);
+            caps.m_structures.append(structure);
+            current = &caps.m_structures.last();
+        }
+    }
+
+    sortFields(caps.m_structures);
+    return caps;
+}
+
+GstCaps GstStudio::GstCaps::fromString(QStringView text) {
+    GstCaps caps;
+    text = text.trimmed();
+    if (text == u"ANY") {
+        caps.m_any = true;
+        return caps;
+    }
+
+    for (QStringView part : splitTopLevel(text, u';')) {
+        // The structure name comes first, "name=value" fields follow; features hold no top-level comma
+        const QList<QStringView> items = splitTopLevel(part);
+        GstCapsStructure structure;
+        if (!parseStructureLine(items.first(), structure)) {
+            continue;
+        }
+
+        for (QStringView item : items.sliced(1)) {
+            const qsizetype separator = item.indexOf(u'=');
+            if (separator <= 0) {
+                continue;
+            }
+            GstCapsField field;
+            field.m_name = item.first(separator).trimmed().toString();
+            field.m_values = parseValue(item.sliced(separator + 1));
+            structure.m_fields.append(field);
+        }
+
+        caps.m_mediaTypeMask |= mediaTypeBit(structure.m_mediaType);
+        caps.m_structures.append(structure);
+    }
+
+    sortFields(caps.m_structures);
+    return caps;
+}
+
+QStringList GstStudio::GstCaps::mediaTypes() const {
+    QStringList types;
+    for (const GstCapsStructure& structure : m_structures) {
+        if (!types.contains(structure.m_mediaType)) {
+            types.append(structure.m_mediaType);
+        }
+    }
+    return types;
+}
+
+bool GstStudio::GstCaps::canIntersect(const GstCaps& first, const GstCaps& second) {
+    // ANY intersects everything except EMPTY
+    if (first.m_any || second.m_any) {
+        return !first.isEmpty() && !second.isEmpty();
+    }
+    if ((first.m_mediaTypeMask & second.m_mediaTypeMask) == 0) {
+        return false;
+    }
+
+    for (const GstCapsStructure& a : first.m_structures) {
+        for (const GstCapsStructure& b : second.m_structures) {
+            if (structuresIntersect(a, b)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool GstStudio::GstCaps::structuresIntersect(const GstCapsStructure& first, const GstCapsStructure& second) {
+    if (first.m_mediaType != second.m_mediaType) {
+        return false;
+    }
+    if (!first.m_anyFeatures && !second.m_anyFeatures && first.m_features != second.m_features) {
+        return false;
+    }
+
+    // Both field lists are sorted by name; only fields present on both sides constrain the result
+    auto a = first.m_fields.cbegin();
+    auto b = second.m_fields.cbegin();
+    while (a != first.m_fields.cend() && b != second.m_fields.cend()) {
+        if (a->m_name < b->m_name) {
+            ++a;
+        } else if (b->m_name < a->m_name) {
+            ++b;
+        } else {
+            if (!valuesIntersect(a->m_values, b->m_values)) {
+                return false;
+            }
+            ++a;
+            ++b;
+        }
+    }
+    return true;
+}
+
+bool GstStudio::GstCaps::valuesIntersect(const QList<GstCapsValue>& first, const QList<GstCapsValue>& second) {
+    if (first.isEmpty() || second.isEmpty()) {
+        return true;
+    }
+
+    for (const GstCapsValue& a : first) {
+        for (const GstCapsValue& b : second) {
+            if (a.m_type != b.m_type) {
+                continue;
+            }
+            if (a.m_type == GstCapsValue::Type::String) {
+                if (a.m_text == b.m_text) {
+                    return true;
+                }
+            } else if (std::max(a.m_min, b.m_min) <= std::min(a.m_max, b.m_max)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool GstStudio::GstCaps::parseStructureLine(QStringView line, GstCapsStructure& structure) {
+    qsizetype typeEnd = 0;
+    while (typeEnd < line.size() && (isMediaTypeChar(line.at(typeEnd)) || line.at(typeEnd) == u'/')) {
+        ++typeEnd;
+    }
+
+    const QStringView mediaType = line.first(typeEnd);
+    const qsizetype slash = mediaType.indexOf(u'/');
+    if (slash <= 0 || slash == mediaType.size() - 1) {
+        return false;
+    }
+
+    QStringView rest = line.sliced(typeEnd).trimmed();
+    if (!rest.isEmpty()) {
+        if (!rest.startsWith(u'(') || !rest.endsWith(u')')) {
+            return false;
+        }
+        for (QStringView feature : qTokenize(rest.sliced(1, rest.size() - 2), u',')) {
+            feature = feature.trimmed();
+            if (feature == u"ANY") {
+                structure.m_anyFeatures = true;
+            } else if (!feature.isEmpty() && feature != kSystemMemoryFeature) {
+                structure.m_features.append(feature.toString());
+            }
+        }
+        std::sort(structure.m_features.begin(), structure.m_features.end());
+    }
+
+    structure.m_mediaType = mediaType.toString();
+    return true;
+}
+
+QList<GstCapsValue> GstStudio::GstCaps::parseValue(QStringView text) {
+    text = text.trimmed();
+    const QStringView typeHint = takeTypeHint(text);
+    if (text.isEmpty()) {
+        return {};
+    }
+
+    if (text.startsWith(u'{') && text.endsWith(u'}')) {
+        QList<GstCapsValue> values;
+        for (QStringView item : splitTopLevel(text.sliced(1, text.size() - 2))) {
+            QStringView element = item;
+            const QStringView itemHint = takeTypeHint(element);
+            GstCapsValue value;
+            if (!parseScalar(element, itemHint.isEmpty() ? typeHint : itemHint, value)) {
+                return {};
+            }
+            values.append(value);
+        }
+        return values;
+    }
+
+    if (text.startsWith(u'[') && text.endsWith(u']')) {
+        // "[ min, max ]" or "[ min, max, step ]"; the step does not matter for intersection
+        const QList<QStringView> bounds = splitTopLevel(text.sliced(1, text.size() - 2));
+        if (bounds.size() < 2) {
+            return {};
+        }
+        GstCapsValue low;
+        GstCapsValue high;
+        if (!parseScalar(bounds.at(0), typeHint, low) || !parseScalar(bounds.at(1), typeHint, high) ||
+            low.m_type != high.m_type || low.m_type == GstCapsValue::Type::String) {
+            return {};
+        }
+        low.m_max = high.m_max;
+        return {low};
+    }
+
+    // Arrays and nested structures are not interpreted
+    if (text.startsWith(u'<') || text.startsWith(u'(')) {
+        return {};
+    }
+
+    GstCapsValue value;
+    if (!parseScalar(text, typeHint, value)) {
+        return {};
+    }
+    return {value};
+}
+
+bool GstStudio::GstCaps::parseScalar(QStringView text, QStringView typeHint, GstCapsValue& value) {
+    const QStringView ownHint = takeTypeHint(text);
+    if (!ownHint.isEmpty()) {
+        typeHint = ownHint;
+    }
+    if (text.isEmpty() || bracketBalance(text) != 0) {
+        return false;
+    }
+
+    if (text.size() >= 2 && text.startsWith(u'"') && text.endsWith(u'"')) {
+        text = text.sliced(1, text.size() - 2);
+        typeHint = u"string";
+    }
+
+    if (typeHint != u"string") {
+        bool ok = false;
+        const qsizetype slash = text.indexOf(u'/');
+        if (slash > 0) {
+            bool denominatorOk = false;
+            const double numerator = text.first(slash).toDouble(&ok);
+            const double denominator = text.sliced(slash + 1).toDouble(&denominatorOk);
+            if (ok && denominatorOk && denominator != 0) {
+                value.m_type = GstCapsValue::Type::Fraction;
+                value.m_min = value.m_max = numerator / denominator;
+                return true;
+            }
+        } else {
+            const double number = text.toDouble(&ok);
+            if (ok) {
+                value.m_type = GstCapsValue::Type::Number;
+                value.m_min = value.m_max = number;
+                return true;
+            }
+        }
+    }
+
+    value.m_type = GstCapsValue::Type::String;
+    value.m_text = text.toString();
+    return true;
+}
+
+QStringView GstStudio::GstCaps::takeTypeHint(QStringView& text) {
+    text = text.trimmed();
+    if (!text.startsWith(u'(')) {
+        return {};
+    }
+    const qsizetype close = text.indexOf(u')');
+    if (close < 0) {
+        return {};
+    }
+
+    const QStringView hint = text.sliced(1, close - 1).trimmed();
+    text = text.sliced(close + 1).trimmed();
+    return hint;
+}
+
+QList<QStringView> GstStudio::GstCaps::splitTopLevel(QStringView text, QChar separator) {
+    QList<QStringView> parts;
+    qsizetype depth = 0;
+    qsizetype start = 0;
+    bool quoted = false;
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        const QChar c = text.at(i);
+        if (c == u'"') {
+            quoted = !quoted;
+        } else if (quoted) {
+            continue;
+        } else if (c == u'{' || c == u'[' || c == u'<' || c == u'(') {
+            ++depth;
+        } else if (c == u'}' || c == u']' || c == u'>' || c == u')') {
+            --depth;
+        } else if (c == separator && depth == 0) {
+            parts.append(text.sliced(start, i - start).trimmed());
+            start = i + 1;
+        }
+    }
+    parts.append(text.sliced(start).trimmed());
+    return parts;
+}
+
+quint64 GstStudio::GstCaps::mediaTypeBit(QStringView mediaType) {
+    return quint64(1) << (qHash(mediaType) & 63);
+}
+
+} // namespace GstStudio
@@ -0,0 +1,201 @@
+/**
+ * @file gstcaps.h
+ * @brief Structured pad template capabilities and compatibility checks
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @struct GstCapsValue
+ * @brief One alternative of a caps field value
+ *
+ * Scalars are stored as ranges whose bounds are equal, so lists, ranges and
+ * plain values intersect the same way.
+ */
+struct GstCapsValue {
+    /**
+     * @enum Type
+     * @brief Value type; values of different types never intersect
+     */
+    enum class Type : quint8 {
+        Number,   ///< Integer or floating point value or range
+        Fraction, ///< Fraction value or range, stored as quotient
+        String    ///< String, boolean or other value compared as text
+    };
+
+    Type m_type = Type::String; ///< Value type
+    double m_min = 0;           ///< Lower bound of a Number or Fraction
+    double m_max = 0;           ///< Upper bound of a Number or Fraction
+    QString m_text;             ///< Text of a String
+};
+
+/**
+ * @struct GstCapsField
+ * @brief Named field of a caps structure
+ */
+struct GstCapsField {
+    QString m_name;               ///< Field name, e.g. "format"
+    QList<GstCapsValue> m_values; ///< Accepted alternatives; empty if the value could not be interpreted
+};
+
+/**
+ * @struct GstCapsStructure
+ * @brief Media type with features and fields, e.g. "video/x-raw(memory:DMABuf)"
+ */
+struct GstCapsStructure {
+    QString m_mediaType;          ///< Media type, e.g. "video/x-raw"
+    QStringList m_features;       ///< Sorted caps features, empty for system memory
+    bool m_anyFeatures = false;   ///< Whether the structure accepts any caps features
+    QList<GstCapsField> m_fields; ///< Fields sorted by name
+};
+
+/**
+ * @class GstCaps
+ * @brief Structured pad template capabilities and compatibility checks
+ *
+ * Parses the capabilities of a pad template as stored in
+ * GstPadTemplate::m_caps: one line per structure ("video/x-raw",
+ * "video/x-raw(memory:DMABuf)", "ANY", "EMPTY") followed by its
+ * "field: value" lines. Values may be typed ("(string)I420"), lists
+ * ("{ a, b }") or ranges ("[ 1, 100 ]").
+ *
+ * canIntersect() decides whether two caps have a common subset, which is
+ * what linking a source pad to a sink pad requires. Caps are parsed once and
+ * checked many times: every caps carries a bitmask of its media types so
+ * most incompatible pairs are rejected with a single AND.
+ */
+class GstCaps {
+  public:
+    /**
+     * @brief Parse capabilities text
+     * @param text Capabilities as stored in GstPadTemplate::m_caps
+     * @return Parsed caps; empty text yields ANY, since nothing restricts the pad
+     */
+    static GstCaps parse(QStringView text);
+
+    /**
+     * @brief Parse capabilities in the serialized form of gst_caps_to_string()
+     *
+     * Structures are separated by ';' and fields by ',', as in
+     * "video/x-raw(memory:DMABuf), format=NV12, width=[ 1, 4096 ]".
+     *
+     * @param text Serialized capabilities, e.g. as passed to gst-launch-1.0
+     * @return Parsed caps; empty text yields EMPTY
+     */
+    static GstCaps fromString(QStringView text);
+
+    /**
+     * @brief Check whether the caps accept anything
+     * @return true for ANY caps
+     */
+    [[nodiscard]] bool isAny() const {
+        return m_any;
+    }
+
+    /**
+     * @brief Check whether the caps accept nothing
+     * @return true for EMPTY caps
+     */
+    [[nodiscard]] bool isEmpty() const {
+        return !m_any && m_structures.isEmpty();
+    }
+
+    /**
+     * @brief Get the parsed structures
+     * @return Structures in declaration order
+     */
+    [[nodiscard]] const QList<GstCapsStructure>& structures() const {
+        return m_structures;
+    }
+
+    /**
+     * @brief Get the distinct media types
+     * @return Media types in declaration order
+     */
+    [[nodiscard]] QStringList mediaTypes() const;
+
+    /**
+     * @brief Check whether two caps have a non-empty intersection
+     *
+     * Structures intersect if media type and features are equal and every
+     * field present in both has a common value. Fields present on one side
+     * only do not restrict the intersection, and values that could not be
+     * interpreted match anything.
+     *
+     * @param first Caps of one pad, usually the source
+     * @param second Caps of the other pad, usually the sink
+     * @return true if the pads can negotiate a common format
+     */
+    static bool canIntersect(const GstCaps& first, const GstCaps& second);
+
+    /**
+     * @brief Check whether two values of a field have a common alternative
+     * @param first Alternatives of one field
+     * @param second Alternatives of the same field in another structure
+     * @return true if an alternative is shared, or either value could not be interpreted
+     */
+    static bool valuesIntersect(const QList<GstCapsValue>& first, const QList<GstCapsValue>& second);
+
+  private:
+    bool m_any = false;                   ///< Whether the caps are ANY
+    QList<GstCapsStructure> m_structures; ///< Parsed structures
+    quint64 m_mediaTypeMask = 0;          ///< One bit per media type hash, for quick rejection
+
+    static bool structuresIntersect(const GstCapsStructure& first, const GstCapsStructure& second);
+
+    /**
+     * @brief Parse a structure line such as "video/x-raw(memory:DMABuf)"
+     * @param line Trimmed line
+     * @param structure Receives media type and features
+     * @return true if the line names a media type
+     */
+    static bool parseStructureLine(QStringView line, GstCapsStructure& structure);
+
+    /**
+     * @brief Parse a field value into its alternatives
+     * @param text Serialized value
+     * @return Alternatives, empty if the value is not understood and must match anything
+     */
+    static QList<GstCapsValue> parseValue(QStringView text);
+
+    /**
+     * @brief Parse a single scalar value
+     * @param text Serialized scalar, optionally with a "(type)" prefix
+     * @param typeHint Type name inherited from an enclosing list or range
+     * @param value Receives the value
+     * @return true if the scalar was understood
+     */
+    static bool parseScalar(QStringView text, QStringView typeHint, GstCapsValue& value);
+
+    /**
+     * @brief Remove a leading "(type)" annotation
+     * @param text Serialized value, trimmed in place
+     * @return Type name, empty if none
+     */
+    static QStringView takeTypeHint(QStringView& text);
+
+    /**
+     * @brief Split the inside of a list or range at top-level commas
+     * @param text Text between the brackets
+     * @param separator Character separating the parts
+     * @return Trimmed parts
+     */
+    static QList<QStringView> splitTopLevel(QStringView text, QChar separator = u',');
+
+    /**
+     * @brief Get the quick-rejection bit of a media type
+     * @param mediaType Media type
+     * @return Single bit mask
+     */
+    static quint64 mediaTypeBit(QStringView mediaType);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,257 @@
+#include "gstcapsindex.h"
+#include "gststringpool.h"
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+namespace GstStudio {
+
+namespace {
+
+QList<int> intersect(const QList<int>& first, const QList<int>& second) {
+    QList<int> result;
+    result.reserve(std::min(first.size(), second.size()));
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(result));
+    return result;
+}
+
+QList<int> unite(const QList<int>& first, const QList<int>& second) {
+    QList<int> result;
+    result.reserve(first.size() + second.size());
+    std::set_union(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(result));
+    return result;
+}
+
+QList<int> subtract(const QList<int>& first, const QList<int>& second) {
+    QList<int> result;
+    result.reserve(first.size());
+    std::set_difference(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(result));
+    return result;
+}
+
+/// Key of the structures of a media type with exactly these features; system memory has none
+QString featuresKey(const QString& mediaType, const QStringList& features) {
+    return mediaType + u'(' + features.join(u',') + u')';
+}
+
+/// Key of the structures of a media type accepting any features
+QString anyFeaturesKey(const QString& mediaType) {
+    return mediaType + QStringLiteral("(ANY)");
+}
+
+/// Key of the structures of a media type restricting a field
+QString fieldKey(const QString& mediaType, const QString& field) {
+    return mediaType + u'|' + field;
+}
+
+/// Key of the structures whose field, see fieldKey(), allows a string value
+QString valueKey(const QString& fieldKey, const QString& value) {
+    return fieldKey + u'=' + value;
+}
+
+const GstCapsField* findField(const GstCapsStructure& structure, const QString& name) {
+    const auto it = std::lower_bound(structure.m_fields.begin(), structure.m_fields.end(), name,
+                                     [](const GstCapsField& field, const QString& key) { return field.m_name < key; });
+    return it != structure.m_fields.end() && it->m_name == name ? &*it : nullptr;
+}
+
+bool isString(const GstCapsValue& value) {
+    return value.m_type == GstCapsValue::Type::String;
+}
+
+/// Share the media type, features, field names and string values, which repeat across pad templates
+void internStructure(GstStringPool& strings, GstCapsStructure& structure) {
+    structure.m_mediaType = strings.intern(structure.m_mediaType);
+    for (QString& feature : structure.m_features) {
+        feature = strings.intern(feature);
+    }
+    for (GstCapsField& field : structure.m_fields) {
+        field.m_name = strings.intern(field.m_name);
+        for (GstCapsValue& value : field.m_values) {
+            if (isString(value)) {
+                value.m_text = strings.intern(value.m_text);
+            }
+        }
+    }
+}
+
+/// Filter words a textual query may start with
+constexpr GstPadTemplate::Direction kDirections[] = {GstPadTemplate::Direction::Src, GstPadTemplate::Direction::Sink};
+constexpr GstPadTemplate::Presence kPresences[] = {
+    GstPadTemplate::Presence::Always, GstPadTemplate::Presence::Sometimes, GstPadTemplate::Presence::Request};
+
+/// Set @p value to the candidate whose display name is @p word, ignoring case
+template <typename Enum, size_t N>
+bool matchName(QStringView word, const Enum (&candidates)[N], QString (*nameOf)(Enum), Enum& value) {
+    for (Enum candidate : candidates) {
+        if (word.compare(nameOf(candidate), Qt::CaseInsensitive) == 0) {
+            value = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+void GstStudio::GstCapsIndex::clear() {
+    m_elements.clear();
+    m_pads.clear();
+    m_structures.clear();
+    m_structurePads.clear();
+    m_postings.clear();
+}
+
+void GstStudio::GstCapsIndex::build(const QList<GstElement>& elements) {
+    clear();
+
+    // Interned strings keep sharing their buffers, so the pool is only needed while structures are added
+    GstStringPool strings;
+    for (const GstElement& element : elements) {
+        const int elementId = static_cast<int>(m_elements.size());
+        m_elements.append({element.m_name, element.m_rank});
+
+        for (const GstPadTemplate& pad : element.m_padTemplates) {
+            const GstCaps caps = GstCaps::parse(pad.m_caps);
+            if (caps.isAny()) {
+                continue;
+            }
+
+            const int padId = static_cast<int>(m_pads.size());
+            m_pads.append(Pad{elementId, pad.m_name, pad.m_direction, pad.m_presence});
+            for (GstCapsStructure structure : caps.structures()) {
+                const int id = static_cast<int>(m_structures.size());
+                internStructure(strings, structure);
+                m_structures.append(structure);
+                m_structurePads.append(padId);
+                indexStructure(id);
+            }
+        }
+    }
+}
+
+QList<GstCapsMatch> GstStudio::GstCapsIndex::search(const GstCaps& query, GstPadTemplate::Direction direction,
+                                                    GstPadTemplate::Presence presence) const {
+    QList<int> structureIds;
+    if (query.isAny()) {
+        structureIds.resize(m_structures.size());
+        std::iota(structureIds.begin(), structureIds.end(), 0);
+    } else {
+        for (const GstCapsStructure& structure : query.structures()) {
+            structureIds = unite(structureIds, matches(structure));
+        }
+    }
+
+    // Structure ids ascend with their pads, so the pads of the matches are ascending too
+    QList<GstCapsMatch> result;
+    int previousPad = -1;
+    for (int id : std::as_const(structureIds)) {
+        const int padId = m_structurePads.at(id);
+        if (padId == previousPad) {
+            continue;
+        }
+        previousPad = padId;
+
+        const Pad& pad = m_pads.at(padId);
+        if ((direction != GstPadTemplate::Direction::Unknown && pad.m_direction != direction) ||
+            (presence != GstPadTemplate::Presence::Unknown && pad.m_presence != presence)) {
+            continue;
+        }
+        const auto& [element, rank] = m_elements.at(pad.m_element);
+        result.append(GstCapsMatch{element, pad.m_name, pad.m_direction, pad.m_presence, rank});
+    }
+
+    std::sort(result.begin(), result.end(), [](const GstCapsMatch& a, const GstCapsMatch& b) {
+        if (a.m_rank != b.m_rank) {
+            return a.m_rank > b.m_rank;
+        }
+        if (a.m_element != b.m_element) {
+            return a.m_element < b.m_element;
+        }
+        return a.m_padTemplate < b.m_padTemplate;
+    });
+    return result;
+}
+
+QList<GstCapsMatch> GstStudio::GstCapsIndex::search(QStringView query) const {
+    GstPadTemplate::Direction direction = GstPadTemplate::Direction::Unknown;
+    GstPadTemplate::Presence presence = GstPadTemplate::Presence::Unknown;
+    query = query.trimmed();
+    while (!query.isEmpty()) {
+        const qsizetype end = query.indexOf(u' ');
+        const QStringView word = end < 0 ? query : query.first(end);
+        if (!matchName(word, kDirections, &GstPadTemplate::directionName, direction) &&
+            !matchName(word, kPresences, &GstPadTemplate::presenceName, presence)) {
+            break;
+        }
+        query = end < 0 ? QStringView() : query.sliced(end + 1).trimmed();
+    }
+
+    return search(GstCaps::fromString(query), direction, presence);
+}
+
+QList<int> GstStudio::GstCapsIndex::matches(const GstCapsStructure& query) const {
+    QList<int> candidates = query.m_anyFeatures
+                                ? m_postings.value(query.m_mediaType)
+                                : unite(m_postings.value(featuresKey(query.m_mediaType, query.m_features)),
+                                        m_postings.value(anyFeaturesKey(query.m_mediaType)));
+
+    for (const GstCapsField& field : query.m_fields) {
+        if (candidates.isEmpty()) {
+            break;
+        }
+        // A query value that could not be interpreted accepts anything, like one in a pad template
+        if (field.m_values.isEmpty()) {
+            continue;
+        }
+
+        // Only candidates restricting the field can reject the value
+        const QString key = fieldKey(query.m_mediaType, field.m_name);
+        const QList<int> restricted = intersect(candidates, m_postings.value(key));
+        QList<int> accepted;
+        if (std::all_of(field.m_values.begin(), field.m_values.end(), isString)) {
+            for (const GstCapsValue& value : field.m_values) {
+                accepted = unite(accepted, m_postings.value(valueKey(key, value.m_text)));
+            }
+            accepted = intersect(accepted, restricted);
+        } else {
+            for (int id : restricted) {
+                if (GstCaps::valuesIntersect(findField(m_structures.at(id), field.m_name)->m_values, field.m_values)) {
+                    accepted.append(id);
+                }
+            }
+        }
+        candidates = subtract(candidates, subtract(restricted, accepted));
+    }
+    return candidates;
+}
+
+void GstStudio::GstCapsIndex::indexStructure(int id) {
+    // Ids are indexed in ascending order, so appending keeps every posting list sorted
+    const GstCapsStructure& structure = m_structures.at(id);
+    m_postings[structure.m_mediaType].append(id);
+    m_postings[structure.m_anyFeatures ? anyFeaturesKey(structure.m_mediaType)
+                                       : featuresKey(structure.m_mediaType, structure.m_features)]
+        .append(id);
+
+    for (const GstCapsField& field : structure.m_fields) {
+        // Values that could not be interpreted accept anything and restrict nothing
+        if (field.m_values.isEmpty()) {
+            continue;
+        }
+
+        const QString key = fieldKey(structure.m_mediaType, field.m_name);
+        m_postings[key].append(id);
+        for (const GstCapsValue& value : field.m_values) {
+            if (!isString(value)) {
+                continue;
+            }
+            QList<int>& postings = m_postings[valueKey(key, value.m_text)];
+            if (postings.isEmpty() || postings.last() != id) {
+                postings.append(id);
+            }
+        }
+    }
+}
+
+} // namespace GstStudio
@@ -0,0 +1,126 @@
+/**
+ * @file gstcapsindex.h
+ * @brief Inverted index over the pad template caps of all elements
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstcaps.h"
+#include "gstelement.h"
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <utility>
+
+namespace GstStudio {
+
+/**
+ * @struct GstCapsMatch
+ * @brief Pad template accepting the caps of a query
+ */
+struct GstCapsMatch {
+    QString m_element;                                                          ///< Element name
+    QString m_padTemplate;                                                      ///< Pad template name
+    GstPadTemplate::Direction m_direction = GstPadTemplate::Direction::Unknown; ///< Pad direction
+    GstPadTemplate::Presence m_presence = GstPadTemplate::Presence::Unknown;    ///< Pad presence
+    int m_rank = GstElement::RankNone;                                          ///< Rank of the element
+};
+
+/**
+ * @class GstCapsIndex
+ * @brief Inverted index over the pad template caps of all elements
+ *
+ * Answers questions such as "which sinks accept video/x-raw, format=NV12
+ * in DMABuf memory" across the whole registry. Every caps structure of
+ * every pad template is posted under its media type, its media type with
+ * caps features, every field it constrains and every string value of
+ * those fields. A query structure starts from the structures of its media
+ * type and features; each query field then removes the structures that
+ * constrain the field to other values. String values are resolved through
+ * their postings, numbers and fractions by checking the few remaining
+ * candidates against their ranges.
+ *
+ * Matching follows caps negotiation: a structure that does not mention a
+ * query field accepts any value for it. Pad templates with ANY caps would
+ * match every query and are left out.
+ */
+class GstCapsIndex {
+  public:
+    /**
+     * @brief Remove all elements
+     */
+    void clear();
+
+    /**
+     * @brief Index the pad templates of a set of elements, replacing the current index
+     * @param elements Elements with their pad templates
+     */
+    void build(const QList<GstElement>& elements);
+
+    /**
+     * @brief Check whether any pad template has been indexed
+     * @return true if no structures are known
+     */
+    [[nodiscard]] bool isEmpty() const {
+        return m_structures.isEmpty();
+    }
+
+    /**
+     * @brief Find the pad templates accepting caps
+     * @param query Caps to look for; a pad template matches if it accepts one of the query structures
+     * @param direction Required pad direction, Unknown for any
+     * @param presence Required pad presence, Unknown for any
+     * @return Matches sorted by descending rank, then element and pad template name
+     */
+    [[nodiscard]] QList<GstCapsMatch>
+    search(const GstCaps& query, GstPadTemplate::Direction direction = GstPadTemplate::Direction::Unknown,
+           GstPadTemplate::Presence presence = GstPadTemplate::Presence::Unknown) const;
+
+    /**
+     * @brief Find the pad templates accepting caps given as text
+     *
+     * The caps string may be preceded by the words "src" or "sink" and
+     * "always", "sometimes" or "request" to filter by direction and
+     * presence, e.g. "sink video/x-raw(memory:DMABuf), format=NV12".
+     *
+     * @param query Filter words followed by caps as in GstCaps::fromString()
+     * @return Matches sorted by descending rank, then element and pad template name
+     */
+    [[nodiscard]] QList<GstCapsMatch> search(QStringView query) const;
+
+  private:
+    /**
+     * @struct Pad
+     * @brief Indexed pad template
+     */
+    struct Pad {
+        int m_element = 0;                                                          ///< Index into m_elements
+        QString m_name;                                                             ///< Pad template name
+        GstPadTemplate::Direction m_direction = GstPadTemplate::Direction::Unknown; ///< Pad direction
+        GstPadTemplate::Presence m_presence = GstPadTemplate::Presence::Unknown;    ///< Pad presence
+    };
+
+    QList<std::pair<QString, int>> m_elements; ///< Element names with their ranks
+    QList<Pad> m_pads;                         ///< Indexed pad templates
+    QList<GstCapsStructure> m_structures;      ///< Parsed structures by id
+    QList<int> m_structurePads;                ///< Pad of every structure, by structure id
+    QHash<QString, QList<int>> m_postings;     ///< Posting key to ascending structure ids
+
+    /**
+     * @brief Get the ids of the structures accepting a query structure
+     * @param query Query structure
+     * @return Ascending structure ids
+     */
+    [[nodiscard]] QList<int> matches(const GstCapsStructure& query) const;
+
+    /**
+     * @brief Post a structure under all of its keys
+     * @param id Structure id
+     */
+    void indexStructure(int id);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,163 @@
+#include "gstcatalogdiff.h"
+#include <QHash>
+#include <QtConcurrent/QtConcurrentMap>
+#include <algorithm>
+
+namespace GstStudio {
+
+namespace {
+
+/// Fixed seed, so fingerprints of both catalogs are comparable regardless of the process-wide qHash seed
+constexpr size_t kFingerprintSeed = 0x9e3779b9;
+
+/// Element with its fingerprint, sorted by name for the merge in compare()
+struct FingerprintedElement {
+    const GstElement* m_element = nullptr;
+    size_t m_fingerprint = 0;
+};
+
+QList<FingerprintedElement> fingerprintAll(const QList<GstElement>& elements) {
+    QList<const GstElement*> pointers;
+    pointers.reserve(elements.size());
+    for (const GstElement& element : elements) {
+        pointers.append(&element);
+    }
+    std::sort(pointers.begin(), pointers.end(),
+              [](const GstElement* a, const GstElement* b) { return a->m_name < b->m_name; });
+
+    return QtConcurrent::blockingMapped<QList<FingerprintedElement>>(pointers, [](const GstElement* element) {
+        return FingerprintedElement{element, GstCatalogDiff::fingerprint(*element)};
+    });
+}
+
+GstCatalogChange change(GstCatalogChange::Kind kind, const QString& element, const QString& item = QString(),
+                        const QString& oldValue = QString(), const QString& newValue = QString()) {
+    return GstCatalogChange{kind, element, item, oldValue, newValue};
+}
+
+/// Index of the items of a list by name
+template <typename T>
+QHash<QString, const T*> byName(const QList<T>& items) {
+    QHash<QString, const T*> index;
+    index.reserve(items.size());
+    for (const T& item : items) {
+        index.insert(item.m_name, &item);
+    }
+    return index;
+}
+
+} // namespace
+
+QString GstStudio::GstCatalogChange::kindName(Kind kind) {
+    switch (kind) {
+        case Kind::ElementAdded:
+            return QStringLiteral("element-added");
+        case Kind::ElementRemoved:
+            return QStringLiteral("element-removed");
+        case Kind::PropertyAdded:
+            return QStringLiteral("property-added");
+        case Kind::PropertyRemoved:
+            return QStringLiteral("property-removed");
+        case Kind::PropertyDefaultChanged:
+            return QStringLiteral("property-default-changed");
+        case Kind::PropertyRangeChanged:
+            return QStringLiteral("property-range-changed");
+        case Kind::PadTemplateAdded:
+            return QStringLiteral("pad-template-added");
+        case Kind::PadTemplateRemoved:
+            return QStringLiteral("pad-template-removed");
+        case Kind::PadCapsChanged:
+            return QStringLiteral("pad-caps-changed");
+    }
+    return {};
+}
+
+QList<GstCatalogChange> GstStudio::GstCatalogDiff::compare(const QList<GstElement>& before,
+                                                           const QList<GstElement>& after) {
+    const QList<FingerprintedElement> older = fingerprintAll(before);
+    const QList<FingerprintedElement> newer = fingerprintAll(after);
+
+    QList<GstCatalogChange> changes;
+    auto oldIt = older.cbegin();
+    auto newIt = newer.cbegin();
+    while (oldIt != older.cend() || newIt != newer.cend()) {
+        if (newIt == newer.cend() || (oldIt != older.cend() && oldIt->m_element->m_name < newIt->m_element->m_name)) {
+            changes.append(change(GstCatalogChange::Kind::ElementRemoved, oldIt->m_element->m_name));
+            ++oldIt;
+        } else if (oldIt == older.cend() || newIt->m_element->m_name < oldIt->m_element->m_name) {
+            changes.append(change(GstCatalogChange::Kind::ElementAdded, newIt->m_element->m_name));
+            ++newIt;
+        } else {
+            // Most elements are identical in both catalogs and end here after one integer comparison
+            if (oldIt->m_fingerprint != newIt->m_fingerprint) {
+                compareElements(*oldIt->m_element, *newIt->m_element, changes);
+            }
+            ++oldIt;
+            ++newIt;
+        }
+    }
+    return changes;
+}
+
+size_t GstStudio::GstCatalogDiff::fingerprint(const GstElement& element) {
+    size_t seed = qHash(element.m_name, kFingerprintSeed);
+    for (const GstProperty& property : element.m_properties) {
+        seed = qHashMulti(seed, property.m_name, property.m_defaultValue, property.m_range);
+    }
+    for (const GstPadTemplate& pad : element.m_padTemplates) {
+        seed = qHashMulti(seed, pad.m_name, static_cast<quint8>(pad.m_direction), static_cast<quint8>(pad.m_presence),
+                          pad.m_caps);
+    }
+    return seed;
+}
+
+void GstStudio::GstCatalogDiff::compareElements(const GstElement& before, const GstElement& after,
+                                                QList<GstCatalogChange>& changes) {
+    using Kind = GstCatalogChange::Kind;
+    const QString& element = after.m_name;
+
+    const QHash<QString, const GstProperty*> oldProperties = byName(before.m_properties);
+    const QHash<QString, const GstProperty*> newProperties = byName(after.m_properties);
+    for (const GstProperty& property : after.m_properties) {
+        const GstProperty* old = oldProperties.value(property.m_name);
+        if (!old) {
+            changes.append(change(Kind::PropertyAdded, element, property.m_name, QString(), property.m_type));
+            continue;
+        }
+        if (old->m_defaultValue != property.m_defaultValue) {
+            changes.append(change(Kind::PropertyDefaultChanged, element, property.m_name, old->m_defaultValue,
+                                  property.m_defaultValue));
+        }
+        if (old->m_range != property.m_range) {
+            changes.append(
+                change(Kind::PropertyRangeChanged, element, property.m_name, old->m_range, property.m_range));
+        }
+    }
+    for (const GstProperty& property : before.m_properties) {
+        if (!newProperties.contains(property.m_name)) {
+            changes.append(change(Kind::PropertyRemoved, element, property.m_name, property.m_type));
+        }
+    }
+
+    const QHash<QString, const GstPadTemplate*> oldPads = byName(before.m_padTemplates);
+    const QHash<QString, const GstPadTemplate*> newPads = byName(after.m_padTemplates);
+    for (const GstPadTemplate& pad : after.m_padTemplates) {
+        const GstPadTemplate* old = oldPads.value(pad.m_name);
+        if (!old || old->m_direction != pad.m_direction || old->m_presence != pad.m_presence) {
+            // A template that changed direction or presence is a different pad to applications
+            if (old) {
+                changes.append(change(Kind::PadTemplateRemoved, element, pad.m_name, old->m_caps));
+            }
+            changes.append(change(Kind::PadTemplateAdded, element, pad.m_name, QString(), pad.m_caps));
+        } else if (old->m_caps != pad.m_caps) {
+            changes.append(change(Kind::PadCapsChanged, element, pad.m_name, old->m_caps, pad.m_caps));
+        }
+    }
+    for (const GstPadTemplate& pad : before.m_padTemplates) {
+        if (!newPads.contains(pad.m_name)) {
+            changes.append(change(Kind::PadTemplateRemoved, element, pad.m_name, pad.m_caps));
+        }
+    }
+}
+
+} // namespace GstStudio
@@ -0,0 +1,107 @@
+/**
+ * @file gstcatalogdiff.h
+ * @brief Comparison of two element catalogs
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QList>
+#include <QString>
+
+namespace GstStudio {
+
+/**
+ * @struct GstCatalogChange
+ * @brief One difference between two element catalogs
+ */
+struct GstCatalogChange {
+    /**
+     * @enum Kind
+     * @brief What changed
+     */
+    enum class Kind : quint8 {
+        ElementAdded,           ///< Element only in the newer catalog
+        ElementRemoved,         ///< Element only in the older catalog
+        PropertyAdded,          ///< Property only in the newer catalog
+        PropertyRemoved,        ///< Property only in the older catalog
+        PropertyDefaultChanged, ///< Default value differs
+        PropertyRangeChanged,   ///< Value range differs
+        PadTemplateAdded,       ///< Pad template only in the newer catalog
+        PadTemplateRemoved,     ///< Pad template only in the older catalog
+        PadCapsChanged          ///< Caps of a pad template differ
+    };
+
+    Kind m_kind = Kind::ElementAdded; ///< What changed
+    QString m_element;                ///< Element name
+    QString m_item;                   ///< Property or pad template name, empty for element changes
+    QString m_oldValue;               ///< Value in the older catalog, empty if added
+    QString m_newValue;               ///< Value in the newer catalog, empty if removed
+
+    /**
+     * @brief Get the display name of a kind
+     * @param kind Change kind
+     * @return Name such as "element-added" or "pad-caps-changed"
+     */
+    static QString kindName(Kind kind);
+
+    bool operator==(const GstCatalogChange& other) const {
+        return m_kind == other.m_kind && m_element == other.m_element && m_item == other.m_item &&
+               m_oldValue == other.m_oldValue && m_newValue == other.m_newValue;
+    }
+
+    bool operator!=(const GstCatalogChange& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @class GstCatalogDiff
+ * @brief Comparison of two element catalogs
+ *
+ * Catalogs of two machines or two GStreamer versions share most of their
+ * elements unchanged. Every element is reduced to a fingerprint over the
+ * compared fields first, on the global thread pool; elements present in
+ * both catalogs with equal fingerprints are skipped, and only the rest is
+ * compared field by field. Fingerprints are only meaningful within one
+ * process and are never stored.
+ */
+class GstCatalogDiff {
+  public:
+    /**
+     * @brief Compute the differences between two catalogs
+     *
+     * Safe to call from any thread. Changes are ordered by element name and,
+     * within an element, properties before pad templates in the order of the
+     * newer catalog, removed items last.
+     *
+     * @param before Older catalog, any order
+     * @param after Newer catalog, any order
+     * @return Added and removed elements, property default and range changes and pad template caps changes
+     */
+    static QList<GstCatalogChange> compare(const QList<GstElement>& before, const QList<GstElement>& after);
+
+    /**
+     * @brief Hash the fields of an element that compare() inspects
+     *
+     * Covers property names, defaults and ranges and pad template names,
+     * directions, presences and caps; descriptions, plugin versions and
+     * other fields that compare() does not report are left out, so a
+     * mismatch yields at least one change unless items were only reordered.
+     *
+     * @param element Element with its details
+     * @return Fingerprint, equal for elements compare() reports no change for
+     */
+    static size_t fingerprint(const GstElement& element);
+
+    /**
+     * @brief Compare two versions of the same element field by field
+     * @param before Element in the older catalog
+     * @param after Element in the newer catalog
+     * @param changes Receives the changes
+     */
+    static void compareElements(const GstElement& before, const GstElement& after, QList<GstCatalogChange>& changes);
+};
+
+} // namespace GstStudio
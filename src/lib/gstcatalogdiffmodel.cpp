@@ -0,0 +1,55 @@
+#include "gstcatalogdiffmodel.h"
+
+namespace GstStudio {
+
+GstStudio::GstCatalogDiffModel::GstCatalogDiffModel(QObject* parent) : QAbstractListModel(parent) {
+}
+
+int GstStudio::GstCatalogDiffModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(m_changes.size());
+}
+
+QVariant GstStudio::GstCatalogDiffModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_changes.size()) {
+        return {};
+    }
+
+    const GstCatalogChange& change = m_changes.at(index.row());
+
+    switch (role) {
+        case KindRole:
+            return GstCatalogChange::kindName(change.m_kind);
+        case ElementRole:
+            return change.m_element;
+        case ItemRole:
+            return change.m_item;
+        case OldValueRole:
+            return change.m_oldValue;
+        case NewValueRole:
+            return change.m_newValue;
+        default:
+            return {};
+    }
+}
+
+QHash<int, QByteArray> GstStudio::GstCatalogDiffModel::roleNames() const {
+    QHash<int, QByteArray> roles;
+    roles[KindRole] = "kind";
+    roles[ElementRole] = "element";
+    roles[ItemRole] = "item";
+    roles[OldValueRole] = "oldValue";
+    roles[NewValueRole] = "newValue";
+    return roles;
+}
+
+void GstStudio::GstCatalogDiffModel::setChanges(const QList<GstCatalogChange>& changes) {
+    // Every comparison yields an unrelated list, so there are no rows worth keeping
+    beginResetModel();
+    m_changes = changes;
+    endResetModel();
+}
+
+} // namespace GstStudio
@@ -0,0 +1,77 @@
+/**
+ * @file gstcatalogdiffmodel.h
+ * @brief Qt model listing the differences between two element catalogs
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstcatalogdiff.h"
+#include <QAbstractListModel>
+#include <QQmlEngine>
+
+namespace GstStudio {
+
+/**
+ * @class GstCatalogDiffModel
+ * @brief Qt model listing the differences between two element catalogs
+ *
+ * One row per change reported by GstCatalogDiff::compare(), in its order,
+ * so the changes of an element are listed together.
+ */
+class GstCatalogDiffModel : public QAbstractListModel {
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by GstElementBrowser")
+
+  public:
+    /**
+     * @enum ChangeRoles
+     * @brief Roles for accessing change data
+     */
+    enum ChangeRoles {
+        KindRole = Qt::UserRole + 1, ///< Change kind, see GstCatalogChange::kindName()
+        ElementRole,                 ///< Element name
+        ItemRole,                    ///< Property or pad template name, empty for element changes
+        OldValueRole,                ///< Value in the older catalog
+        NewValueRole                 ///< Value in the newer catalog
+    };
+
+    /**
+     * @brief Constructs a new GstCatalogDiffModel
+     * @param parent Parent QObject
+     */
+    explicit GstCatalogDiffModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Get number of changes
+     * @param parent Parent model index (unused)
+     * @return Number of changes
+     */
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    /**
+     * @brief Get data for a specific change
+     * @param index Model index
+     * @param role Data role
+     * @return QVariant containing requested data
+     */
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Get role names for QML access
+     * @return Hash of role names
+     */
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+    /**
+     * @brief Replace all changes
+     * @param changes Changes to list
+     */
+    void setChanges(const QList<GstCatalogChange>& changes);
+
+  private:
+    QList<GstCatalogChange> m_changes; ///< Listed changes
+};
+
+} // namespace GstStudio
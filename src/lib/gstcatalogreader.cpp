@@ -0,0 +1,172 @@
+#include "gstcatalogreader.h"
+#include "gstcatalogwriter.h"
+#include "gstinspectparser.h"
+#include <QCborArray>
+#include <QCborValue>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <initializer_list>
+
+namespace GstStudio {
+
+namespace {
+
+/// Initial bytes of a CBOR map, definite (0xa0-0xbb) or indefinite (0xbf) length
+constexpr quint8 kCborMapFirst = 0xa0;
+constexpr quint8 kCborMapLast = 0xbf;
+
+QStringList stringList(const QCborValue& value) {
+    const QCborArray array = value.toArray();
+    QStringList strings;
+    strings.reserve(array.size());
+    for (const QCborValue& item : array) {
+        strings.append(item.toString());
+    }
+    return strings;
+}
+
+/// Map a display name back to its enumerator, @p fallback if none of @p candidates has that name
+template <typename Enum>
+Enum fromName(const QString& name, std::initializer_list<Enum> candidates, QString (*nameOf)(Enum), Enum fallback) {
+    for (Enum candidate : candidates) {
+        if (nameOf(candidate) == name) {
+            return candidate;
+        }
+    }
+    return fallback;
+}
+
+GstProperty::Flags propertyFlags(const QCborValue& value) {
+    GstProperty::Flags flags;
+    for (const QString& flag : stringList(value)) {
+        if (flag == u"readable") {
+            flags |= GstProperty::Readable;
+        } else if (flag == u"writable") {
+            flags |= GstProperty::Writable;
+        } else if (flag == u"controllable") {
+            flags |= GstProperty::Controllable;
+        }
+    }
+    return flags;
+}
+
+bool fail(QString* errorMessage, const QString& message) {
+    if (errorMessage) {
+        *errorMessage = message;
+    }
+    return false;
+}
+
+} // namespace
+
+bool GstStudio::GstCatalogReader::read(QByteArrayView data, QList<GstElement>& elements, QString* errorMessage) {
+    const QByteArrayView document = data.trimmed();
+    const auto first = document.isEmpty() ? quint8(0) : static_cast<quint8>(document.front());
+
+    QCborMap map;
+    if (first == '{') {
+        QJsonParseError error;
+        const QJsonDocument json = QJsonDocument::fromJson(document.toByteArray(), &error);
+        if (error.error != QJsonParseError::NoError) {
+            return fail(errorMessage, QStringLiteral("invalid JSON catalog: %1").arg(error.errorString()));
+        }
+        map = QCborMap::fromJsonObject(json.object());
+    } else if (first >= kCborMapFirst && first <= kCborMapLast) {
+        QCborParserError error;
+        const QCborValue cbor = QCborValue::fromCbor(document.data(), document.size(), &error);
+        if (error.error != QCborError::NoError) {
+            return fail(errorMessage, QStringLiteral("invalid CBOR catalog: %1").arg(error.errorString()));
+        }
+        map = cbor.toMap();
+    } else {
+        elements = GstInspectParser::parseOutput(data);
+        return true;
+    }
+
+    const qint64 version = map.value(QStringLiteral("version")).toInteger();
+    if (version < 1 || version > GstCatalogWriter::kDocumentVersion) {
+        return fail(errorMessage, QStringLiteral("unsupported catalog version %1").arg(version));
+    }
+
+    const QCborArray array = map.value(QStringLiteral("elements")).toArray();
+    elements.clear();
+    elements.reserve(array.size());
+    for (const QCborValue& element : array) {
+        elements.append(elementFromMap(element.toMap()));
+    }
+    return true;
+}
+
+bool GstStudio::GstCatalogReader::readFile(const QString& path, QList<GstElement>& elements, QString* errorMessage) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return fail(errorMessage, QStringLiteral("cannot read %1: %2").arg(path, file.errorString()));
+    }
+    return read(file.readAll(), elements, errorMessage);
+}
+
+GstElement GstStudio::GstCatalogReader::elementFromMap(const QCborMap& map) {
+    GstElement element;
+    element.m_name = map.value(QStringLiteral("name")).toString();
+    element.m_longName = map.value(QStringLiteral("longName")).toString();
+    element.m_classification = map.value(QStringLiteral("classification")).toString();
+    element.m_description = map.value(QStringLiteral("description")).toString();
+    element.m_author = map.value(QStringLiteral("author")).toString();
+    element.m_rank = static_cast<int>(map.value(QStringLiteral("rank")).toInteger());
+
+    const QCborMap plugin = map.value(QStringLiteral("plugin")).toMap();
+    element.m_pluginName = plugin.value(QStringLiteral("name")).toString();
+    element.m_pluginFilename = plugin.value(QStringLiteral("filename")).toString();
+    element.m_pluginVersion = plugin.value(QStringLiteral("version")).toString();
+    element.m_pluginLicense = plugin.value(QStringLiteral("license")).toString();
+
+    const QCborMap uri = map.value(QStringLiteral("uri")).toMap();
+    element.m_uriType = fromName(uri.value(QStringLiteral("type")).toString(),
+                                 {GstElement::UriType::Source, GstElement::UriType::Sink}, &GstElement::uriTypeName,
+                                 GstElement::UriType::None);
+    element.m_uriProtocols = stringList(uri.value(QStringLiteral("protocols")));
+
+    for (const QCborValue& value : map.value(QStringLiteral("properties")).toArray()) {
+        const QCborMap entry = value.toMap();
+        GstProperty property;
+        property.m_name = entry.value(QStringLiteral("name")).toString();
+        property.m_type = entry.value(QStringLiteral("type")).toString();
+        property.m_description = entry.value(QStringLiteral("description")).toString();
+        property.m_defaultValue = entry.value(QStringLiteral("default")).toString();
+        property.m_range = entry.value(QStringLiteral("range")).toString();
+        property.m_flags = propertyFlags(entry.value(QStringLiteral("flags")));
+        property.m_enumValues = stringList(entry.value(QStringLiteral("values")));
+        element.m_properties.append(property);
+    }
+
+    for (const QCborValue& value : map.value(QStringLiteral("padTemplates")).toArray()) {
+        const QCborMap entry = value.toMap();
+        GstPadTemplate pad;
+        pad.m_name = entry.value(QStringLiteral("name")).toString();
+        pad.m_direction = fromName(entry.value(QStringLiteral("direction")).toString(),
+                                   {GstPadTemplate::Direction::Src, GstPadTemplate::Direction::Sink},
+                                   &GstPadTemplate::directionName, GstPadTemplate::Direction::Unknown);
+        pad.m_presence = fromName(entry.value(QStringLiteral("presence")).toString(),
+                                  {GstPadTemplate::Presence::Always, GstPadTemplate::Presence::Sometimes,
+                                   GstPadTemplate::Presence::Request},
+                                  &GstPadTemplate::presenceName, GstPadTemplate::Presence::Unknown);
+        pad.m_caps = entry.value(QStringLiteral("caps")).toString();
+        element.m_padTemplates.append(pad);
+    }
+
+    for (const QCborValue& value : map.value(QStringLiteral("signals")).toArray()) {
+        const QCborMap entry = value.toMap();
+        GstSignal descriptor;
+        descriptor.m_name = entry.value(QStringLiteral("name")).toString();
+        descriptor.m_kind = fromName(entry.value(QStringLiteral("kind")).toString(), {GstSignal::Kind::Action},
+                                     &GstSignal::kindName, GstSignal::Kind::Signal);
+        descriptor.m_returnType = entry.value(QStringLiteral("returnType")).toString();
+        descriptor.m_argumentTypes = stringList(entry.value(QStringLiteral("argumentTypes")));
+        element.m_signals.append(descriptor);
+    }
+
+    return element;
+}
+
+} // namespace GstStudio
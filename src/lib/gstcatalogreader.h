@@ -0,0 +1,58 @@
+/**
+ * @file gstcatalogreader.h
+ * @brief Loading of exported catalog dumps and recorded gst-inspect-1.0 output
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QByteArrayView>
+#include <QCborMap>
+#include <QList>
+#include <QString>
+
+namespace GstStudio {
+
+/**
+ * @class GstCatalogReader
+ * @brief Loading of exported catalog dumps and recorded gst-inspect-1.0 output
+ *
+ * Reads the JSON and CBOR documents written by GstCatalogWriter back into
+ * elements, so catalogs exported on other machines can be compared or
+ * browsed. Anything that is not a dump is taken as recorded
+ * gst-inspect-1.0 --print-all output. All functions may be called from
+ * any thread.
+ */
+class GstCatalogReader {
+  public:
+    /**
+     * @brief Read the elements of a dump or of recorded gst-inspect-1.0 output
+     * @param data File contents; dumps are recognized by their first byte
+     * @param elements Receives the elements in document order
+     * @param errorMessage Receives the reason if reading failed, may be null
+     * @return false if a dump could not be decoded or holds an unsupported version
+     */
+    static bool read(QByteArrayView data, QList<GstElement>& elements, QString* errorMessage = nullptr);
+
+    /**
+     * @brief Read the elements of a dump or of recorded gst-inspect-1.0 output from a file
+     * @param path File path
+     * @param elements Receives the elements in document order
+     * @param errorMessage Receives the reason if reading failed, may be null
+     * @return false if the file could not be read or decoded
+     */
+    static bool readFile(const QString& path, QList<GstElement>& elements, QString* errorMessage = nullptr);
+
+    /**
+     * @brief Decode an element from the document schema
+     *
+     * Inverse of GstCatalogWriter::elementMap(); missing fields are left empty.
+     *
+     * @param map Map of element fields
+     * @return Element with its details
+     */
+    static GstElement elementFromMap(const QCborMap& map);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,141 @@
+#include "gstcatalogwriter.h"
+#include <QCborArray>
+#include <QCborValue>
+#include <QJsonDocument>
+
+namespace GstStudio {
+
+namespace {
+
+/// CBOR initial bytes of containers whose end is marked by a break byte
+constexpr char kCborIndefiniteArray = '\x9f';
+constexpr char kCborIndefiniteMap = '\xbf';
+constexpr char kCborBreak = '\xff';
+
+QCborArray stringArray(const QStringList& strings) {
+    QCborArray array;
+    for (const QString& text : strings) {
+        array.append(text);
+    }
+    return array;
+}
+
+QCborArray propertyFlags(const GstProperty& property) {
+    QCborArray flags;
+    if (property.isReadable()) {
+        flags.append(QStringLiteral("readable"));
+    }
+    if (property.isWritable()) {
+        flags.append(QStringLiteral("writable"));
+    }
+    if (property.isControllable()) {
+        flags.append(QStringLiteral("controllable"));
+    }
+    return flags;
+}
+
+} // namespace
+
+GstStudio::GstCatalogWriter::GstCatalogWriter(QIODevice* device, Format format) : m_device(device), m_format(format) {
+    // The element array stays open until finish(), so its length need not be known up front
+    if (m_format == Format::Cbor) {
+        QByteArray start(1, kCborIndefiniteMap);
+        start += QCborValue(QStringLiteral("version")).toCbor();
+        start += QCborValue(kDocumentVersion).toCbor();
+        start += QCborValue(QStringLiteral("elements")).toCbor();
+        start += kCborIndefiniteArray;
+        write(start);
+    } else {
+        write("{\"version\":" + QByteArray::number(kDocumentVersion) + ",\"elements\":[\n");
+    }
+}
+
+void GstStudio::GstCatalogWriter::writeElement(const GstElement& element) {
+    const QCborMap map = elementMap(element);
+    if (m_format == Format::Cbor) {
+        write(QCborValue(map).toCbor());
+    } else {
+        QByteArray line = QJsonDocument(map.toJsonObject()).toJson(QJsonDocument::Compact);
+        if (!m_firstElement) {
+            line.prepend(",\n");
+        }
+        write(line);
+    }
+    m_firstElement = false;
+}
+
+bool GstStudio::GstCatalogWriter::finish() {
+    if (m_format == Format::Cbor) {
+        write(QByteArray(2, kCborBreak));
+    } else {
+        write(QByteArrayLiteral("\n]}\n"));
+    }
+    return !m_failed;
+}
+
+bool GstStudio::GstCatalogWriter::formatFromName(QStringView name, Format& format) {
+    if (name.compare(u"json", Qt::CaseInsensitive) == 0) {
+        format = Format::Json;
+        return true;
+    }
+    if (name.compare(u"cbor", Qt::CaseInsensitive) == 0) {
+        format = Format::Cbor;
+        return true;
+    }
+    return false;
+}
+
+QCborMap GstStudio::GstCatalogWriter::elementMap(const GstElement& element) {
+    QCborArray properties;
+    for (const GstProperty& property : element.m_properties) {
+        properties.append(QCborMap{{QStringLiteral("name"), property.m_name},
+                                   {QStringLiteral("type"), property.m_type},
+                                   {QStringLiteral("description"), property.m_description},
+                                   {QStringLiteral("default"), property.m_defaultValue},
+                                   {QStringLiteral("range"), property.m_range},
+                                   {QStringLiteral("flags"), propertyFlags(property)},
+                                   {QStringLiteral("values"), stringArray(property.m_enumValues)}});
+    }
+
+    QCborArray pads;
+    for (const GstPadTemplate& pad : element.m_padTemplates) {
+        pads.append(QCborMap{{QStringLiteral("name"), pad.m_name},
+                             {QStringLiteral("direction"), GstPadTemplate::directionName(pad.m_direction)},
+                             {QStringLiteral("presence"), GstPadTemplate::presenceName(pad.m_presence)},
+                             {QStringLiteral("caps"), pad.m_caps}});
+    }
+
+    QCborArray signalArray;
+    for (const GstSignal& descriptor : element.m_signals) {
+        signalArray.append(QCborMap{{QStringLiteral("name"), descriptor.m_name},
+                                    {QStringLiteral("kind"), GstSignal::kindName(descriptor.m_kind)},
+                                    {QStringLiteral("returnType"), descriptor.m_returnType},
+                                    {QStringLiteral("argumentTypes"), stringArray(descriptor.m_argumentTypes)}});
+    }
+
+    return QCborMap{{QStringLiteral("name"), element.m_name},
+                    {QStringLiteral("longName"), element.m_longName},
+                    {QStringLiteral("classification"), element.m_classification},
+                    {QStringLiteral("description"), element.m_description},
+                    {QStringLiteral("author"), element.m_author},
+                    {QStringLiteral("rank"), element.m_rank},
+                    {QStringLiteral("plugin"),
+                     QCborMap{{QStringLiteral("name"), element.m_pluginName},
+                              {QStringLiteral("filename"), element.m_pluginFilename},
+                              {QStringLiteral("version"), element.m_pluginVersion},
+                              {QStringLiteral("license"), element.m_pluginLicense}}},
+                    {QStringLiteral("uri"),
+                     QCborMap{{QStringLiteral("type"), GstElement::uriTypeName(element.m_uriType)},
+                              {QStringLiteral("protocols"), stringArray(element.m_uriProtocols)}}},
+                    {QStringLiteral("properties"), properties},
+                    {QStringLiteral("padTemplates"), pads},
+                    {QStringLiteral("signals"), signalArray}};
+}
+
+void GstStudio::GstCatalogWriter::write(const QByteArray& data) {
+    if (!m_failed && m_device->write(data) != data.size()) {
+        m_failed = true;
+    }
+}
+
+} // namespace GstStudio
@@ -0,0 +1,91 @@
+/**
+ * @file gstcatalogwriter.h
+ * @brief Streaming JSON and CBOR export of the element catalog
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QByteArray>
+#include <QCborMap>
+#include <QIODevice>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @class GstCatalogWriter
+ * @brief Streaming JSON and CBOR export of the element catalog
+ *
+ * The document is a map holding a format version and the element array:
+ * {"version": 1, "elements": [...]}. Elements are encoded and written one
+ * at a time, so exporting a catalog only ever holds a single element in
+ * memory besides the device buffer. Every element carries all fields,
+ * empty ones included, so consumers can rely on a fixed shape.
+ */
+class GstCatalogWriter {
+  public:
+    /// Document version written; incremented whenever a field is renamed or removed
+    static constexpr int kDocumentVersion = 1;
+
+    /**
+     * @enum Format
+     * @brief Encoding of the written document
+     */
+    enum class Format {
+        Json, ///< Compact JSON, one element per line
+        Cbor  ///< CBOR with indefinite-length containers
+    };
+
+    /**
+     * @brief Constructs a writer and writes the start of the document
+     * @param device Open, writable device; must outlive the writer
+     * @param format Encoding of the document
+     */
+    GstCatalogWriter(QIODevice* device, Format format);
+
+    GstCatalogWriter(const GstCatalogWriter&) = delete;
+    GstCatalogWriter& operator=(const GstCatalogWriter&) = delete;
+
+    /**
+     * @brief Append an element to the document
+     * @param element Element with its details
+     */
+    void writeElement(const GstElement& element);
+
+    /**
+     * @brief Write the end of the document; no elements may follow
+     * @return true if every write to the device succeeded
+     */
+    bool finish();
+
+    /**
+     * @brief Look up a format by name
+     * @param name "json" or "cbor", case-insensitive
+     * @param format Receives the format
+     * @return true if the name is known
+     */
+    static bool formatFromName(QStringView name, Format& format);
+
+    /**
+     * @brief Encode an element in the document schema
+     * @param element Element with its details
+     * @return Map of all element fields
+     */
+    static QCborMap elementMap(const GstElement& element);
+
+  private:
+    QIODevice* m_device;        ///< Destination of the document
+    Format m_format;            ///< Encoding of the document
+    bool m_firstElement = true; ///< Whether no element has been written yet
+    bool m_failed = false;      ///< Whether a write to m_device failed
+
+    /**
+     * @brief Write encoded bytes to the device, remembering failures
+     * @param data Encoded part of the document
+     */
+    void write(const QByteArray& data);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,345 @@
+#include "gstcompatibilitygraph.h"
+#include "gstcaps.h"
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace GstStudio {
+
+namespace {
+
+constexpr quint32 kGraphMagic = 0x4753544c; // "GSTL"
+constexpr quint32 kGraphVersion = 2;
+
+/// Smallest serialized pad (element index and an empty name) and edge (two pad indexes)
+constexpr qint64 kMinPadSize = sizeof(qint32) + sizeof(quint32);
+constexpr qint64 kEdgeSize = sizeof(qint32) + sizeof(qint32);
+
+/// Longest chain findPath() proposes, counting source and sink
+constexpr int kMaxPathElements = 8;
+
+QStringList distinctSorted(QStringList names) {
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+    return names;
+}
+
+} // namespace
+
+void GstStudio::GstCompatibilityGraph::clear() {
+    m_elementNames.clear();
+    m_elementIds.clear();
+    m_ranks.clear();
+    m_pads.clear();
+    m_downstream.clear();
+    m_upstream.clear();
+    m_linkCount = 0;
+}
+
+void GstStudio::GstCompatibilityGraph::build(const QList<GstElement>& elements) {
+    clear();
+
+    QList<const GstElement*> sorted;
+    sorted.reserve(elements.size());
+    for (const GstElement& element : elements) {
+        sorted.append(&element);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const GstElement* a, const GstElement* b) { return a->m_name < b->m_name; });
+
+    // Parse every pad template once; sinks are bucketed by media type so each source pad
+    // is only intersected with sinks that can possibly match
+    QList<GstCaps> caps;
+    QList<int> sourcePads;
+    QList<int> anySinkPads;
+    QList<int> allSinkPads;
+    QHash<QString, QList<int>> sinkPadsByMediaType;
+
+    for (const GstElement* element : std::as_const(sorted)) {
+        const int elementId = static_cast<int>(m_elementNames.size());
+        m_elementNames.append(element->m_name);
+        m_ranks.append(element->m_rank);
+
+        for (const GstPadTemplate& padTemplate : element->m_padTemplates) {
+            if (padTemplate.m_direction == GstPadTemplate::Direction::Unknown) {
+                continue;
+            }
+
+            const int padId = static_cast<int>(m_pads.size());
+            m_pads.append({elementId, padTemplate.m_name});
+            caps.append(GstCaps::parse(padTemplate.m_caps));
+            const GstCaps& padCaps = caps.last();
+
+            if (padTemplate.m_direction == GstPadTemplate::Direction::Src) {
+                sourcePads.append(padId);
+            } else if (!padCaps.isEmpty()) {
+                allSinkPads.append(padId);
+                if (padCaps.isAny()) {
+                    anySinkPads.append(padId);
+                }
+                for (const QString& mediaType : padCaps.mediaTypes()) {
+                    sinkPadsByMediaType[mediaType].append(padId);
+                }
+            }
+        }
+    }
+
+    indexElementNames();
+    m_downstream.resize(m_elementNames.size());
+    m_upstream.resize(m_elementNames.size());
+
+    QList<int> candidates;
+    for (int sourcePad : std::as_const(sourcePads)) {
+        const GstCaps& sourceCaps = caps.at(sourcePad);
+        if (sourceCaps.isEmpty()) {
+            continue;
+        }
+
+        if (sourceCaps.isAny()) {
+            candidates = allSinkPads;
+        } else {
+            candidates = anySinkPads;
+            for (const QString& mediaType : sourceCaps.mediaTypes()) {
+                candidates.append(sinkPadsByMediaType.value(mediaType));
+            }
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        }
+
+        const int sourceElement = m_pads.at(sourcePad).m_element;
+        for (int sinkPad : std::as_const(candidates)) {
+            if (m_pads.at(sinkPad).m_element != sourceElement && GstCaps::canIntersect(sourceCaps, caps.at(sinkPad))) {
+                addEdge({sourcePad, sinkPad});
+            }
+        }
+    }
+}
+
+bool GstStudio::GstCompatibilityGraph::load(const QString& path, const QByteArray& fingerprint) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray storedFingerprint;
+    stream >> magic >> version >> storedFingerprint;
+    if (magic != kGraphMagic || version != kGraphVersion || storedFingerprint != fingerprint) {
+        return false;
+    }
+
+    GstCompatibilityGraph graph;
+    quint32 padCount = 0;
+    stream >> graph.m_elementNames >> graph.m_ranks >> padCount;
+    // Counts come from disk; one the remaining bytes cannot hold means the file is damaged
+    if (graph.m_ranks.size() != graph.m_elementNames.size() || stream.status() != QDataStream::Ok ||
+        padCount > (file.size() - file.pos()) / kMinPadSize) {
+        return false;
+    }
+    graph.m_pads.reserve(padCount);
+    for (quint32 i = 0; i < padCount && stream.status() == QDataStream::Ok; ++i) {
+        qint32 element = -1;
+        QString name;
+        stream >> element >> name;
+        if (element < 0 || element >= graph.m_elementNames.size()) {
+            return false;
+        }
+        graph.m_pads.append({element, name});
+    }
+
+    quint32 edgeCount = 0;
+    stream >> edgeCount;
+    if (stream.status() != QDataStream::Ok || edgeCount > (file.size() - file.pos()) / kEdgeSize) {
+        return false;
+    }
+    graph.indexElementNames();
+    graph.m_downstream.resize(graph.m_elementNames.size());
+    graph.m_upstream.resize(graph.m_elementNames.size());
+    for (quint32 i = 0; i < edgeCount && stream.status() == QDataStream::Ok; ++i) {
+        qint32 sourcePad = -1;
+        qint32 sinkPad = -1;
+        stream >> sourcePad >> sinkPad;
+        if (sourcePad < 0 || sourcePad >= graph.m_pads.size() || sinkPad < 0 || sinkPad >= graph.m_pads.size()) {
+            return false;
+        }
+        graph.addEdge({sourcePad, sinkPad});
+    }
+    if (stream.status() != QDataStream::Ok) {
+        return false;
+    }
+
+    *this = std::move(graph);
+    return true;
+}
+
+bool GstStudio::GstCompatibilityGraph::save(const QString& path, const QByteArray& fingerprint) const {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << kGraphMagic << kGraphVersion << fingerprint << m_elementNames << m_ranks
+           << static_cast<quint32>(m_pads.size());
+    for (const Pad& pad : m_pads) {
+        stream << static_cast<qint32>(pad.m_element) << pad.m_name;
+    }
+
+    stream << static_cast<quint32>(m_linkCount);
+    for (const QList<Edge>& edges : m_downstream) {
+        for (const Edge& edge : edges) {
+            stream << static_cast<qint32>(edge.m_sourcePad) << static_cast<qint32>(edge.m_sinkPad);
+        }
+    }
+    return file.commit();
+}
+
+QList<GstPadLink> GstStudio::GstCompatibilityGraph::downstreamLinks(const QString& elementName) const {
+    QList<GstPadLink> links;
+    const int id = m_elementIds.value(elementName, -1);
+    if (id < 0) {
+        return links;
+    }
+
+    links.reserve(m_downstream.at(id).size());
+    for (const Edge& edge : m_downstream.at(id)) {
+        links.append(link(edge));
+    }
+    return links;
+}
+
+QList<GstPadLink> GstStudio::GstCompatibilityGraph::upstreamLinks(const QString& elementName) const {
+    QList<GstPadLink> links;
+    const int id = m_elementIds.value(elementName, -1);
+    if (id < 0) {
+        return links;
+    }
+
+    links.reserve(m_upstream.at(id).size());
+    for (const Edge& edge : m_upstream.at(id)) {
+        links.append(link(edge));
+    }
+    return links;
+}
+
+QStringList GstStudio::GstCompatibilityGraph::downstreamElements(const QString& elementName) const {
+    QStringList names;
+    const int id = m_elementIds.value(elementName, -1);
+    if (id >= 0) {
+        for (const Edge& edge : m_downstream.at(id)) {
+            names.append(m_elementNames.at(m_pads.at(edge.m_sinkPad).m_element));
+        }
+    }
+    return distinctSorted(names);
+}
+
+QStringList GstStudio::GstCompatibilityGraph::upstreamElements(const QString& elementName) const {
+    QStringList names;
+    const int id = m_elementIds.value(elementName, -1);
+    if (id >= 0) {
+        for (const Edge& edge : m_upstream.at(id)) {
+            names.append(m_elementNames.at(m_pads.at(edge.m_sourcePad).m_element));
+        }
+    }
+    return distinctSorted(names);
+}
+
+QStringList GstStudio::GstCompatibilityGraph::findPath(const QString& sourceElement, const QString& sinkElement,
+                                                      int budgetMs) const {
+    const int source = m_elementIds.value(sourceElement, -1);
+    const int sink = m_elementIds.value(sinkElement, -1);
+    if (source < 0 || sink < 0 || source == sink) {
+        return {};
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    constexpr double kUnreached = std::numeric_limits<double>::infinity();
+    QList<double> cost(m_elementNames.size(), kUnreached);
+    QList<int> previous(m_elementNames.size(), -1);
+    QList<int> length(m_elementNames.size(), 0);
+
+    using Entry = std::pair<double, int>; // cost, element id
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+    cost[source] = 0;
+    length[source] = 1;
+    queue.push({0, source});
+
+    int visited = 0;
+    while (!queue.empty()) {
+        const auto [current, id] = queue.top();
+        queue.pop();
+        if (current > cost.at(id)) {
+            continue;
+        }
+        if (id == sink) {
+            break;
+        }
+        if ((++visited & 63) == 0 && timer.elapsed() > budgetMs) {
+            return {};
+        }
+
+        // An element at the length limit may still be followed by the sink, but by nothing else
+        const bool lastInBetween = length.at(id) >= kMaxPathElements - 1;
+        for (const Edge& edge : m_downstream.at(id)) {
+            const int next = m_pads.at(edge.m_sinkPad).m_element;
+            const int rank = m_ranks.at(next);
+            if (next != sink && (lastInBetween || rank <= GstElement::RankNone)) {
+                continue;
+            }
+
+            // One step per element, plus up to one more the further its rank is below primary
+            constexpr double kPrimary = GstElement::RankPrimary;
+            const double step = next == sink ? 1.0 : 2.0 - std::min(rank / kPrimary, 1.0);
+            if (current + step < cost.at(next)) {
+                cost[next] = current + step;
+                previous[next] = id;
+                length[next] = length.at(id) + 1;
+                queue.push({cost.at(next), next});
+            }
+        }
+    }
+
+    if (previous.at(sink) < 0) {
+        return {};
+    }
+
+    QStringList path;
+    for (int id = sink; id >= 0; id = previous.at(id)) {
+        path.prepend(m_elementNames.at(id));
+    }
+    return path;
+}
+
+void GstStudio::GstCompatibilityGraph::addEdge(const Edge& edge) {
+    m_downstream[m_pads.at(edge.m_sourcePad).m_element].append(edge);
+    m_upstream[m_pads.at(edge.m_sinkPad).m_element].append(edge);
+    ++m_linkCount;
+}
+
+GstPadLink GstStudio::GstCompatibilityGraph::link(const Edge& edge) const {
+    const Pad& source = m_pads.at(edge.m_sourcePad);
+    const Pad& sink = m_pads.at(edge.m_sinkPad);
+    return {m_elementNames.at(source.m_element), source.m_name, m_elementNames.at(sink.m_element), sink.m_name};
+}
+
+void GstStudio::GstCompatibilityGraph::indexElementNames() {
+    m_elementIds.clear();
+    m_elementIds.reserve(m_elementNames.size());
+    for (int id = 0; id < m_elementNames.size(); ++id) {
+        m_elementIds.insert(m_elementNames.at(id), id);
+    }
+}
+
+} // namespace GstStudio
@@ -0,0 +1,172 @@
+/**
+ * @file gstcompatibilitygraph.h
+ * @brief Precomputed graph of compatible pad templates across all elements
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+namespace GstStudio {
+
+/**
+ * @struct GstPadLink
+ * @brief Source pad template of one element that can feed a sink pad template of another
+ */
+struct GstPadLink {
+    QString m_sourceElement; ///< Name of the upstream element
+    QString m_sourcePad;     ///< Name of its SRC pad template
+    QString m_sinkElement;   ///< Name of the downstream element
+    QString m_sinkPad;       ///< Name of its SINK pad template
+};
+
+/**
+ * @class GstCompatibilityGraph
+ * @brief Precomputed graph of compatible pad templates across all elements
+ *
+ * Every SRC pad template is linked to every SINK pad template of another
+ * element whose caps intersect with it. Building parses the caps of all pad
+ * templates once and only intersects pads sharing a media type, plus pads
+ * with ANY caps, instead of checking all pairs. Queries afterwards are plain
+ * lookups.
+ *
+ * The graph depends only on the installed plugins, so it is stored on disk
+ * together with the plugin fingerprint and loaded instead of rebuilt while
+ * the fingerprint matches.
+ */
+class GstCompatibilityGraph {
+  public:
+    /**
+     * @brief Remove all elements and links
+     */
+    void clear();
+
+    /**
+     * @brief Compute the links between the pad templates of a set of elements
+     * @param elements Elements with their pad templates, replacing the current graph
+     */
+    void build(const QList<GstElement>& elements);
+
+    /**
+     * @brief Load a graph stored with save()
+     * @param path Graph file path
+     * @param fingerprint Plugin fingerprint the graph must have been stored with
+     * @return true if the file was read and matched the fingerprint
+     */
+    bool load(const QString& path, const QByteArray& fingerprint);
+
+    /**
+     * @brief Store the graph
+     * @param path Graph file path, replaced atomically
+     * @param fingerprint Plugin fingerprint of the elements the graph was built from
+     * @return true if the file was written
+     */
+    bool save(const QString& path, const QByteArray& fingerprint) const;
+
+    /**
+     * @brief Check whether the graph has been built or loaded
+     * @return true if no elements are known
+     */
+    [[nodiscard]] bool isEmpty() const {
+        return m_elementNames.isEmpty();
+    }
+
+    /**
+     * @brief Get number of pad template links
+     * @return Link count
+     */
+    [[nodiscard]] int linkCount() const {
+        return m_linkCount;
+    }
+
+    /**
+     * @brief Get the links leaving an element
+     * @param elementName Upstream element
+     * @return Links from its SRC pad templates, grouped by source pad
+     */
+    [[nodiscard]] QList<GstPadLink> downstreamLinks(const QString& elementName) const;
+
+    /**
+     * @brief Get the links entering an element
+     * @param elementName Downstream element
+     * @return Links into its SINK pad templates, grouped by sink pad
+     */
+    [[nodiscard]] QList<GstPadLink> upstreamLinks(const QString& elementName) const;
+
+    /**
+     * @brief Get the elements that can be linked after an element
+     * @param elementName Upstream element
+     * @return Distinct element names, sorted
+     */
+    [[nodiscard]] QStringList downstreamElements(const QString& elementName) const;
+
+    /**
+     * @brief Get the elements that can be linked before an element
+     * @param elementName Downstream element
+     * @return Distinct element names, sorted
+     */
+    [[nodiscard]] QStringList upstreamElements(const QString& elementName) const;
+
+    /**
+     * @brief Find the cheapest chain of elements linking a source to a sink
+     *
+     * Runs Dijkstra over the element graph. Every element in between costs
+     * one step plus a penalty that shrinks with its rank, so short chains of
+     * preferred elements win. Elements of rank none are not autoplugged, just
+     * as decodebin skips them, which keeps ANY-caps helpers like queue or
+     * identity out of the proposal. The search gives up when the chain grows
+     * beyond a handful of elements or the time budget runs out.
+     *
+     * @param sourceElement First element of the chain
+     * @param sinkElement Last element of the chain
+     * @param budgetMs Search time budget in milliseconds
+     * @return Element names from source to sink, empty if no chain was found in time
+     */
+    [[nodiscard]] QStringList findPath(const QString& sourceElement, const QString& sinkElement,
+                                       int budgetMs = 50) const;
+
+  private:
+    struct Pad {
+        int m_element = -1; ///< Owning element id
+        QString m_name;     ///< Pad template name
+    };
+
+    struct Edge {
+        int m_sourcePad = -1; ///< Id of the SRC pad
+        int m_sinkPad = -1;   ///< Id of the SINK pad
+    };
+
+    QStringList m_elementNames;       ///< Element names by id, sorted
+    QHash<QString, int> m_elementIds; ///< Element name to id
+    QList<int> m_ranks;               ///< Element ranks by id
+    QList<Pad> m_pads;                ///< Pad templates by id
+    QList<QList<Edge>> m_downstream;  ///< Edges leaving each element, by element id
+    QList<QList<Edge>> m_upstream;    ///< Edges entering each element, by element id
+    int m_linkCount = 0;              ///< Total number of edges
+
+    /**
+     * @brief Record an edge in both directions
+     * @param edge Edge between two pads of different elements
+     */
+    void addEdge(const Edge& edge);
+
+    /**
+     * @brief Resolve the ids of an edge to names
+     * @param edge Edge
+     * @return Link with element and pad names
+     */
+    [[nodiscard]] GstPadLink link(const Edge& edge) const;
+
+    /**
+     * @brief Rebuild the element name lookup from m_elementNames
+     */
+    void indexElementNames();
+};
+
+} // namespace GstStudio
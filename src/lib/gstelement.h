@@ -1,13 +1,16 @@
 /**
  * @file gstelement.h
- * @brief Data structures for GStreamer elements, properties and pad templates
+ * @brief Data structures for GStreamer elements, properties, pad templates and signals
  * @author GstStudio Team
  */
 
 #pragma once
 
+#include <QFlags>
 #include <QList>
 #include <QString>
+#include <QStringList>
+#include <utility>
 
 namespace GstStudio {
 
@@ -17,17 +20,51 @@ namespace GstStudio {
  *
  * This structure contains all the metadata for a GStreamer element property,
  * including its name, type, description, default value, and various flags.
+ * Strings that repeat across elements (type and enum values) are interned
+ * through the GstStringPool of the catalog holding the element.
  */
 struct GstProperty {
-    QString m_name;              ///< Property name
-    QString m_type;              ///< Property type (e.g., "gint", "gboolean", "gchararray")
-    QString m_description;       ///< Human-readable description of the property
-    QString m_defaultValue;      ///< Default value as string
-    QString m_range;             ///< Valid range for numeric properties
-    QStringList m_enumValues;    ///< Valid enum values for enum properties
-    bool m_writable = false;     ///< Whether the property can be written to
-    bool m_readable = false;     ///< Whether the property can be read from
-    bool m_controllable = false; ///< Whether the property can be controlled via GstController
+    /**
+     * @enum Flag
+     * @brief Property flags; values match the catalog file format
+     */
+    enum Flag : quint8 {
+        NoFlags = 0x0,     ///< No flags set
+        Readable = 0x1,    ///< Property can be read from
+        Writable = 0x2,    ///< Property can be written to
+        Controllable = 0x4 ///< Property can be controlled via GstController
+    };
+    Q_DECLARE_FLAGS(Flags, Flag)
+
+    QString m_name;           ///< Property name
+    QString m_type;           ///< Property type (e.g., "Integer", "Boolean", "String")
+    QString m_description;    ///< Human-readable description of the property
+    QString m_defaultValue;   ///< Default value as string
+    QString m_range;          ///< Valid range for numeric properties
+    QStringList m_enumValues; ///< Valid enum values for enum properties
+    Flags m_flags;            ///< Access and control flags
+
+    [[nodiscard]] bool isReadable() const {
+        return m_flags.testFlag(Readable);
+    }
+
+    [[nodiscard]] bool isWritable() const {
+        return m_flags.testFlag(Writable);
+    }
+
+    [[nodiscard]] bool isControllable() const {
+        return m_flags.testFlag(Controllable);
+    }
+
+    bool operator==(const GstProperty& other) const {
+        return m_name == other.m_name && m_type == other.m_type && m_description == other.m_description &&
+               m_defaultValue == other.m_defaultValue && m_range == other.m_range &&
+               m_enumValues == other.m_enumValues && m_flags == other.m_flags;
+    }
+
+    bool operator!=(const GstProperty& other) const {
+        return !(*this == other);
+    }
 };
 
 /**
@@ -38,10 +75,117 @@ struct GstProperty {
  * including their direction, presence, and supported capabilities.
  */
 struct GstPadTemplate {
-    QString m_name;      ///< Pad template name
-    QString m_direction; ///< Pad direction: "SRC" or "SINK"
-    QString m_presence;  ///< Pad presence: "ALWAYS", "SOMETIMES", or "REQUEST"
-    QString m_caps;      ///< Supported capabilities as string
+    /**
+     * @enum Direction
+     * @brief Pad direction; values match the catalog file format
+     */
+    enum class Direction : quint8 {
+        Unknown, ///< Not reported
+        Src,     ///< Source pad
+        Sink     ///< Sink pad
+    };
+
+    /**
+     * @enum Presence
+     * @brief Pad availability; values match the catalog file format
+     */
+    enum class Presence : quint8 {
+        Unknown,   ///< Not reported
+        Always,    ///< Pad always exists
+        Sometimes, ///< Pad is created dynamically
+        Request    ///< Pad is created on request
+    };
+
+    QString m_name;                             ///< Pad template name
+    Direction m_direction = Direction::Unknown; ///< Pad direction
+    Presence m_presence = Presence::Unknown;    ///< Pad presence
+    QString m_caps;                             ///< Supported capabilities as string
+
+    /**
+     * @brief Get the display name of a direction
+     * @param direction Pad direction
+     * @return "SRC", "SINK" or an empty string
+     */
+    static QString directionName(Direction direction) {
+        switch (direction) {
+            case Direction::Src:
+                return QStringLiteral("SRC");
+            case Direction::Sink:
+                return QStringLiteral("SINK");
+            default:
+                return {};
+        }
+    }
+
+    /**
+     * @brief Get the display name of a presence
+     * @param presence Pad presence
+     * @return "ALWAYS", "SOMETIMES", "REQUEST" or an empty string
+     */
+    static QString presenceName(Presence presence) {
+        switch (presence) {
+            case Presence::Always:
+                return QStringLiteral("ALWAYS");
+            case Presence::Sometimes:
+                return QStringLiteral("SOMETIMES");
+            case Presence::Request:
+                return QStringLiteral("REQUEST");
+            default:
+                return {};
+        }
+    }
+
+    bool operator==(const GstPadTemplate& other) const {
+        return m_name == other.m_name && m_direction == other.m_direction && m_presence == other.m_presence &&
+               m_caps == other.m_caps;
+    }
+
+    bool operator!=(const GstPadTemplate& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @struct GstSignal
+ * @brief Represents a signal or action signal of a GStreamer element
+ *
+ * Argument types leave out the emitting element and the user_data pointer
+ * every handler receives, so the handoff signal of fakesink has the
+ * argument types "GstBuffer*" and "GstPad*". Pointer types are written
+ * without a space before the '*'.
+ */
+struct GstSignal {
+    /**
+     * @enum Kind
+     * @brief Who emits the signal; values match the catalog file format
+     */
+    enum class Kind : quint8 {
+        Signal, ///< Emitted by the element, applications connect to it
+        Action  ///< Emitted by the application to make the element act
+    };
+
+    QString m_name;              ///< Signal name (e.g., "pad-added")
+    Kind m_kind = Kind::Signal;  ///< Signal or action
+    QString m_returnType;        ///< Return type (e.g., "void", "GstSample*")
+    QStringList m_argumentTypes; ///< Argument types in declaration order
+
+    /**
+     * @brief Get the display name of a kind
+     * @param kind Signal kind
+     * @return "signal" or "action"
+     */
+    static QString kindName(Kind kind) {
+        return kind == Kind::Action ? QStringLiteral("action") : QStringLiteral("signal");
+    }
+
+    bool operator==(const GstSignal& other) const {
+        return m_name == other.m_name && m_kind == other.m_kind && m_returnType == other.m_returnType &&
+               m_argumentTypes == other.m_argumentTypes;
+    }
+
+    bool operator!=(const GstSignal& other) const {
+        return !(*this == other);
+    }
 };
 
 /**
@@ -52,14 +196,77 @@ struct GstPadTemplate {
  * including its properties, pad templates, and descriptive information.
  */
 struct GstElement {
+    /**
+     * @enum Rank
+     * @brief Named autoplugging ranks; any value in between is valid too
+     */
+    enum Rank : int {
+        RankNone = 0,        ///< Never autoplugged
+        RankMarginal = 64,   ///< Autoplugged as a last resort
+        RankSecondary = 128, ///< Autoplugged if no primary element fits
+        RankPrimary = 256    ///< Preferred for autoplugging
+    };
+
+    /**
+     * @enum UriType
+     * @brief Role of the element as a URI handler; values match the catalog file format
+     */
+    enum class UriType : quint8 {
+        None,   ///< Not a URI handler
+        Source, ///< Reads from URIs, e.g. filesrc
+        Sink    ///< Writes to URIs, e.g. filesink
+    };
+
     QString m_name;                       ///< Element name (e.g., "videotestsrc")
     QString m_longName;                   ///< Human-readable long name
     QString m_description;                ///< Element description
     QString m_author;                     ///< Element author information
     QString m_classification;             ///< Element classification (e.g., "Source/Video")
-    QString m_rank;                       ///< Element rank for autoplugging
+    int m_rank = RankNone;                ///< Element rank for autoplugging
+    QString m_pluginName;                 ///< Name of the plugin providing the element
+    QString m_pluginFilename;             ///< Shared library the plugin was loaded from
+    QString m_pluginVersion;              ///< Version of the plugin
+    QString m_pluginLicense;              ///< License of the plugin (e.g., "LGPL")
+    UriType m_uriType = UriType::None;    ///< URI handling capability
+    QStringList m_uriProtocols;           ///< URI protocols handled (e.g., "file")
     QList<GstProperty> m_properties;      ///< List of element properties
     QList<GstPadTemplate> m_padTemplates; ///< List of pad templates
+    QList<GstSignal> m_signals;           ///< Signals followed by action signals, in gst-inspect-1.0 order
+
+    /**
+     * @brief Get the display name of a rank, as printed by gst-inspect-1.0
+     * @param rank Rank value
+     * @return Name of the nearest named rank at or below @p rank, with the offset if any, e.g. "primary + 1"
+     */
+    static QString rankName(int rank) {
+        const std::pair<int, const char*> names[] = {
+            {RankPrimary, "primary"}, {RankSecondary, "secondary"}, {RankMarginal, "marginal"}, {RankNone, "none"}};
+        for (const auto& [value, name] : names) {
+            if (rank >= value) {
+                const QString base = QString::fromLatin1(name);
+                return rank == value ? base : QStringLiteral("%1 + %2").arg(base).arg(rank - value);
+            }
+        }
+        return QString::number(rank);
+    }
+
+    /**
+     * @brief Get the display name of a URI type
+     * @param uriType URI handling capability
+     * @return "source", "sink" or an empty string
+     */
+    static QString uriTypeName(UriType uriType) {
+        switch (uriType) {
+            case UriType::Source:
+                return QStringLiteral("source");
+            case UriType::Sink:
+                return QStringLiteral("sink");
+            default:
+                return {};
+        }
+    }
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(GstProperty::Flags)
+
 } // namespace GstStudio
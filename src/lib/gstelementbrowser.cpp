@@ -1,52 +1,392 @@
 #include "gstelementbrowser.h"
+#include "gstcatalogreader.h"
+#include "gstregistrycache.h"
+#include <QFutureWatcher>
+#include <QSet>
+#include <QtConcurrent/QtConcurrentRun>
+#include <algorithm>
 
 namespace GstStudio {
 
+namespace {
+
+/// Outcome of a catalog comparison run on the thread pool
+struct CatalogComparison {
+    QList<GstCatalogChange> m_changes; ///< Changes from the older to the newer catalog
+    QString m_errorMessage;            ///< Reason the comparison failed, empty on success
+};
+
+/// Indexes over the element details, built together so the details are loaded once
+struct CatalogIndexes {
+    GstCompatibilityGraph m_graph; ///< Links between compatible pad templates
+    GstPropertyIndex m_properties; ///< Elements by property name, type and flags
+    GstCapsIndex m_caps;           ///< Pad templates by media type, features and field values
+};
+
+/// Names of the matched elements, each once, in match order; @p padTemplates receives the matched pads per element
+QStringList elementNames(const QList<GstCapsMatch>& matches, QHash<QString, QStringList>* padTemplates = nullptr) {
+    QStringList names;
+    QSet<QString> seen;
+    for (const GstCapsMatch& match : matches) {
+        if (!seen.contains(match.m_element)) {
+            seen.insert(match.m_element);
+            names.append(match.m_element);
+        }
+        if (padTemplates) {
+            (*padTemplates)[match.m_element].append(match.m_padTemplate);
+        }
+    }
+    return names;
+}
+
+} // namespace
+
 GstStudio::GstElementBrowser::GstElementBrowser(QObject* parent)
     : QObject(parent), m_parser(new GstInspectParser(this)), m_propertyModel(new GstPropertyModel(this)),
-      m_padModel(new GstPadModel(this)) {
+      m_padModel(new GstPadModel(this)), m_signalModel(new GstSignalModel(this)),
+      m_diffModel(new GstCatalogDiffModel(this)), m_elementModel(new GstElementListModel(this)),
+      m_filterModel(new GstElementFilterModel(this)) {
+    m_filterModel->setSourceModel(m_elementModel);
+
     connect(m_parser, &GstInspectParser::parsingFinished, this, &GstElementBrowser::onParsingFinished);
     connect(m_parser, &GstInspectParser::elementParsed, this, &GstElementBrowser::onElementParsed);
+    connect(m_parser, &GstInspectParser::parsingFailed, this, &GstElementBrowser::onParsingFailed);
+    connect(m_parser, &GstInspectParser::parsingProgress, this, &GstElementBrowser::onParsingProgress);
+    connect(m_parser, &GstInspectParser::catalogReset, this, &GstElementBrowser::onCatalogReset);
+    connect(m_parser, &GstInspectParser::elementAdded, this, &GstElementBrowser::onElementAdded);
+    connect(m_parser, &GstInspectParser::elementRemoved, this, &GstElementBrowser::onElementRemoved);
+    connect(m_parser, &GstInspectParser::elementUpdated, this, &GstElementBrowser::onElementUpdated);
 }
 
 void GstStudio::GstElementBrowser::setSelectedElement(const QString& elementName) {
     if (m_selectedElement != elementName) {
         m_selectedElement = elementName;
         updateElementDetails();
+        prefetchNeighbours();
         emit selectedElementChanged();
     }
 }
 
-void GstStudio::GstElementBrowser::refreshElements() {
+QString GstStudio::GstElementBrowser::elementPlugin() const {
+    QString plugin = m_currentElement.m_pluginName;
+    if (!m_currentElement.m_pluginVersion.isEmpty()) {
+        plugin += u' ';
+        plugin += m_currentElement.m_pluginVersion;
+    }
+    if (!m_currentElement.m_pluginLicense.isEmpty()) {
+        plugin += QStringLiteral(" (%1)").arg(m_currentElement.m_pluginLicense);
+    }
+    return plugin.trimmed();
+}
+
+QString GstStudio::GstElementBrowser::elementUriHandling() const {
+    if (m_currentElement.m_uriType == GstElement::UriType::None) {
+        return {};
+    }
+    return QStringLiteral("%1: %2").arg(GstElement::uriTypeName(m_currentElement.m_uriType),
+                                        m_currentElement.m_uriProtocols.join(QStringLiteral(", ")));
+}
+
+void GstStudio::GstElementBrowser::refreshElements(bool forceRescan) {
+    if (m_isLoading) {
+        return;
+    }
+
     m_isLoading = true;
+    m_loadedCount = 0;
+    m_expectedCount = 0;
     emit loadingChanged();
-    m_parser->parseAllElements();
+    emit loadingProgressChanged();
+
+    // Returns immediately; completion is reported through parsingFinished/parsingFailed, synchronously on a cache hit
+    if (!m_parser->parseAllElements(!forceRescan)) {
+        m_isLoading = false;
+        emit loadingChanged();
+    }
+}
+
+void GstStudio::GstElementBrowser::cancelRefresh() {
+    m_parser->cancelParsing();
+}
+
+void GstStudio::GstElementBrowser::setSearchMode(SearchMode mode) {
+    if (m_searchMode != mode) {
+        m_searchMode = mode;
+        filterElements(m_filter);
+        emit searchModeChanged();
+    }
 }
 
 void GstStudio::GstElementBrowser::filterElements(const QString& filter) {
+    m_filter = filter;
+    if (m_searchMode != ElementSearch) {
+        requestCatalogIndexes();
+    }
+
     if (filter.isEmpty()) {
-        m_filteredElementNames = m_elementNames;
+        m_filterModel->clearMatches();
+    } else if (m_searchMode == PropertySearch) {
+        // One lookup yields the result and the matching properties every delegate shows
+        const QMap<QString, QStringList> properties = m_propertyIndex.matchingProperties(filter);
+        QHash<QString, QStringList> details;
+        details.reserve(properties.size());
+        for (auto it = properties.constBegin(); it != properties.constEnd(); ++it) {
+            details.insert(it.key(), it.value());
+        }
+        m_filterModel->setMatches(properties.keys(), details);
+    } else if (m_searchMode == CapsSearch) {
+        // Searched once per query; delegates show the matched pad templates from the filter model
+        QHash<QString, QStringList> padTemplates;
+        const QStringList names = elementNames(m_capsIndex.search(filter), &padTemplates);
+        m_filterModel->setMatches(names, padTemplates);
     } else {
-        m_filteredElementNames.clear();
-        for (const QString& name : std::as_const(m_elementNames)) {
-            if (name.contains(filter, Qt::CaseInsensitive)) {
-                m_filteredElementNames.append(name);
+        m_filterModel->setMatches(m_index.search(filter));
+    }
+}
+
+QStringList GstStudio::GstElementBrowser::searchProperties(const QString& query) {
+    requestCatalogIndexes();
+    return m_propertyIndex.search(query);
+}
+
+QStringList GstStudio::GstElementBrowser::searchCaps(const QString& query) {
+    requestCatalogIndexes();
+    return elementNames(m_capsIndex.search(query));
+}
+
+QStringList GstStudio::GstElementBrowser::downstreamElements(const QString& elementName) {
+    requestCatalogIndexes();
+    return m_compatibilityGraph.downstreamElements(elementName);
+}
+
+QStringList GstStudio::GstElementBrowser::upstreamElements(const QString& elementName) {
+    requestCatalogIndexes();
+    return m_compatibilityGraph.upstreamElements(elementName);
+}
+
+QStringList GstStudio::GstElementBrowser::autoplugPath(const QString& sourceElement, const QString& sinkElement) {
+    requestCatalogIndexes();
+    return m_compatibilityGraph.findPath(sourceElement, sinkElement);
+}
+
+void GstStudio::GstElementBrowser::compareCatalogs(const QUrl& before, const QUrl& after) {
+    const int generation = ++m_comparisonGeneration;
+    if (!m_isComparing) {
+        m_isComparing = true;
+        emit comparingChanged();
+    }
+
+    auto* watcher = new QFutureWatcher<CatalogComparison>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, generation]() {
+        watcher->deleteLater();
+        if (generation != m_comparisonGeneration) {
+            return;
+        }
+        const CatalogComparison comparison = watcher->result();
+        m_isComparing = false;
+        m_diffModel->setChanges(comparison.m_changes);
+        if (!comparison.m_errorMessage.isEmpty()) {
+            emit comparisonFailed(comparison.m_errorMessage);
+        }
+        emit comparingChanged();
+    });
+
+    // Reading and parsing both catalogs takes as long as a refresh, so none of it runs on the GUI thread
+    watcher->setFuture(QtConcurrent::run([beforePath = before.toLocalFile(), afterPath = after.toLocalFile(),
+                                          loader = m_parser->elementLoader()]() {
+        const auto load = [&loader](const QString& path, QList<GstElement>& elements, QString* errorMessage) {
+            if (path.isEmpty()) {
+                elements = loader();
+                return true;
             }
+            return GstCatalogReader::readFile(path, elements, errorMessage);
+        };
+
+        CatalogComparison comparison;
+        QList<GstElement> older;
+        QList<GstElement> newer;
+        if (load(beforePath, older, &comparison.m_errorMessage) && load(afterPath, newer, &comparison.m_errorMessage)) {
+            comparison.m_changes = GstCatalogDiff::compare(older, newer);
         }
-    }
-    emit elementNamesChanged();
+        return comparison;
+    }));
 }
 
 void GstStudio::GstElementBrowser::onParsingFinished() {
+    finishRefresh();
+    if (m_indexesInUse && !m_indexesCurrent) {
+        rebuildCatalogIndexes(true);
+    }
+}
+
+void GstStudio::GstElementBrowser::onCatalogReset() {
+    invalidateCatalogIndexes();
     m_elementNames = m_parser->getAllElementNames();
-    m_filteredElementNames = m_elementNames;
+    reloadElements();
+    filterElements(m_filter);
+    updateElementDetails();
+}
+
+void GstStudio::GstElementBrowser::onElementAdded(const QString& elementName) {
+    auto it = std::lower_bound(m_elementNames.begin(), m_elementNames.end(), elementName);
+    if (it != m_elementNames.end() && *it == elementName) {
+        return;
+    }
+    m_elementNames.insert(it, elementName);
+    invalidateCatalogIndexes();
+
+    const GstElement header = m_parser->getElementHeader(elementName);
+    m_index.insert(header);
+    m_elementModel->insertElement(header);
+
+    // The new element may match the current search
+    if (!m_filter.isEmpty()) {
+        filterElements(m_filter);
+    }
+}
+
+void GstStudio::GstElementBrowser::onElementRemoved(const QString& elementName) {
+    invalidateCatalogIndexes();
+    m_elementNames.removeOne(elementName);
+    m_index.remove(elementName);
+    m_elementModel->removeElement(elementName);
+
+    if (elementName == m_selectedElement) {
+        setSelectedElement(QString());
+    }
+}
+
+void GstStudio::GstElementBrowser::onElementUpdated(const QString& elementName) {
+    invalidateCatalogIndexes();
+    const GstElement header = m_parser->getElementHeader(elementName);
+    m_index.insert(header);
+    m_elementModel->insertElement(header);
+    if (elementName == m_selectedElement) {
+        updateElementDetails();
+    }
+}
+
+void GstStudio::GstElementBrowser::onParsingFailed(const QString& errorMessage) {
+    // Keep whatever was discovered before the failure browsable; the indexes of the catalog from before the
+    // refresh were dropped with it, so they are built for the partial catalog, without storing its graph
+    finishRefresh();
+    if (m_indexesInUse && !m_indexesCurrent) {
+        rebuildCatalogIndexes(false);
+    }
+    emit loadingFailed(errorMessage);
+}
+
+void GstStudio::GstElementBrowser::onParsingProgress(int current, int total) {
+    m_loadedCount = current;
+    m_expectedCount = total;
+    emit loadingProgressChanged();
+}
+
+void GstStudio::GstElementBrowser::onElementParsed(const QString& elementName) {
+    Q_UNUSED(elementName)
+    // Progress is tracked through parsingProgress; the list and index are rebuilt once parsing completes
+    m_elementsCurrent = false;
+}
+
+void GstStudio::GstElementBrowser::reloadElements() {
+    QList<GstElement> headers;
+    headers.reserve(m_elementNames.size());
+    m_index.clear();
+    for (const QString& name : std::as_const(m_elementNames)) {
+        headers.append(m_parser->getElementHeader(name));
+        m_index.insert(headers.last());
+    }
+    m_elementModel->setElements(headers);
+    m_elementsCurrent = true;
+}
+
+void GstStudio::GstElementBrowser::finishRefresh() {
+    // An incremental refresh has already patched the list and index element by element
+    const QStringList names = m_parser->getAllElementNames();
+    if (names != m_elementNames || !m_elementsCurrent) {
+        m_elementNames = names;
+        reloadElements();
+        filterElements(m_filter);
+
+        // A full scan started from an empty catalog; the selection kept its name but lost its details
+        updateElementDetails();
+    }
+
     m_isLoading = false;
-    emit elementNamesChanged();
     emit loadingChanged();
 }
 
-void GstStudio::GstElementBrowser::onElementParsed(const QString& elementName) {
-    // Could emit progress updates here if needed
+void GstStudio::GstElementBrowser::requestCatalogIndexes() {
+    if (m_indexesInUse) {
+        return;
+    }
+
+    // Building them loads the details of every element, so only once they are asked for; after that they
+    // follow every catalog change
+    m_indexesInUse = true;
+    if (!m_isLoading) {
+        rebuildCatalogIndexes(true);
+    }
+}
+
+void GstStudio::GstElementBrowser::invalidateCatalogIndexes() {
+    // Drops the result of a build still running for the previous catalog
+    ++m_indexGeneration;
+    if (m_indexesCurrent) {
+        m_indexesCurrent = false;
+        m_compatibilityGraph = GstCompatibilityGraph();
+        m_propertyIndex = GstPropertyIndex();
+        m_capsIndex = GstCapsIndex();
+        emit compatibilityGraphChanged();
+    }
+
+    // Refreshes rebuild them once they end
+    if (m_indexesInUse && !m_isLoading) {
+        rebuildCatalogIndexes(true);
+    }
+}
+
+void GstStudio::GstElementBrowser::rebuildCatalogIndexes(bool completeCatalog) {
+    const int generation = ++m_indexGeneration;
+    const QString cacheFilePath = completeCatalog ? m_parser->cacheFilePath() : QString();
+    const QString graphPath =
+        cacheFilePath.isEmpty() ? QString() : GstRegistryCache::compatibilityGraphFilePath(cacheFilePath);
+
+    auto* watcher = new QFutureWatcher<CatalogIndexes>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, generation]() {
+        watcher->deleteLater();
+        if (generation != m_indexGeneration) {
+            return;
+        }
+        const CatalogIndexes indexes = watcher->result();
+        m_compatibilityGraph = indexes.m_graph;
+        m_propertyIndex = indexes.m_properties;
+        m_capsIndex = indexes.m_caps;
+        m_indexesCurrent = true;
+        if (m_searchMode != ElementSearch) {
+            filterElements(m_filter);
+        }
+        emit compatibilityGraphChanged();
+    });
+
+    watcher->setFuture(QtConcurrent::run([graphPath, loader = m_parser->elementLoader()]() {
+        const QList<GstElement> elements = loader();
+        CatalogIndexes indexes;
+        indexes.m_properties.build(elements);
+        indexes.m_caps.build(elements);
+
+        // The graph only changes with the installed plugins, so the stored one is reused while they match
+        const QByteArray fingerprint = GstRegistryCache::currentFingerprint();
+        if (!graphPath.isEmpty() && indexes.m_graph.load(graphPath, fingerprint)) {
+            return indexes;
+        }
+
+        indexes.m_graph.build(elements);
+        if (!graphPath.isEmpty()) {
+            indexes.m_graph.save(graphPath, fingerprint);
+        }
+        return indexes;
+    }));
 }
 
 void GstStudio::GstElementBrowser::updateElementDetails() {
@@ -58,7 +398,28 @@ void GstStudio::GstElementBrowser::updateElementDetails() {
 
     m_propertyModel->setProperties(m_currentElement.m_properties);
     m_padModel->setPadTemplates(m_currentElement.m_padTemplates);
+    m_signalModel->setSignals(m_currentElement.m_signals);
     emit elementDetailsChanged();
 }
 
+void GstStudio::GstElementBrowser::prefetchNeighbours() {
+    // Selections usually move to an adjacent entry; have its details ready by then
+    constexpr int kPrefetchRadius = 2;
+
+    const int row = m_filterModel->rowOf(m_selectedElement);
+    if (row < 0) {
+        return;
+    }
+
+    QStringList neighbours;
+    const int first = std::max(0, row - kPrefetchRadius);
+    const int last = std::min(m_filterModel->rowCount() - 1, row + kPrefetchRadius);
+    for (int i = first; i <= last; ++i) {
+        if (i != row) {
+            neighbours.append(m_filterModel->nameAt(i));
+        }
+    }
+    m_parser->prefetchDetails(neighbours);
+}
+
 } // namespace GstStudio
@@ -6,12 +6,21 @@
 
 #pragma once
 
+#include "gstcapsindex.h"
+#include "gstcatalogdiffmodel.h"
+#include "gstcompatibilitygraph.h"
+#include "gstelementfiltermodel.h"
+#include "gstelementindex.h"
+#include "gstelementlistmodel.h"
 #include "gstinspectparser.h" // Your parser from previous artifact
 #include "gstpadmodel.h"
+#include "gstpropertyindex.h"
 #include "gstpropertymodel.h"
+#include "gstsignalmodel.h"
 #include <QAbstractListModel>
 #include <QObject>
 #include <QQmlEngine>
+#include <QUrl>
 
 namespace GstStudio {
 
@@ -21,22 +30,41 @@ namespace GstStudio {
  *
  * This class provides a QML interface for browsing GStreamer elements.
  * It manages element discovery, selection, and provides models for
- * displaying element properties and pad templates.
+ * displaying element properties, pad templates and signals.
  */
 class GstElementBrowser : public QObject {
     Q_OBJECT
     QML_ELEMENT
 
-    Q_PROPERTY(QStringList elementNames READ elementNames NOTIFY elementNamesChanged)
+    Q_PROPERTY(GstElementFilterModel* elementModel READ elementModel CONSTANT)
+    Q_PROPERTY(SearchMode searchMode READ searchMode WRITE setSearchMode NOTIFY searchModeChanged)
     Q_PROPERTY(QString selectedElement READ selectedElement WRITE setSelectedElement NOTIFY selectedElementChanged)
     Q_PROPERTY(QString elementDescription READ elementDescription NOTIFY elementDetailsChanged)
     Q_PROPERTY(QString elementClassification READ elementClassification NOTIFY elementDetailsChanged)
     Q_PROPERTY(QString elementAuthor READ elementAuthor NOTIFY elementDetailsChanged)
+    Q_PROPERTY(QString elementPlugin READ elementPlugin NOTIFY elementDetailsChanged)
+    Q_PROPERTY(QString elementUriHandling READ elementUriHandling NOTIFY elementDetailsChanged)
     Q_PROPERTY(GstPropertyModel* propertyModel READ propertyModel CONSTANT)
     Q_PROPERTY(GstPadModel* padModel READ padModel CONSTANT)
+    Q_PROPERTY(GstSignalModel* signalModel READ signalModel CONSTANT)
     Q_PROPERTY(bool isLoading READ isLoading NOTIFY loadingChanged)
+    Q_PROPERTY(int loadedCount READ loadedCount NOTIFY loadingProgressChanged)
+    Q_PROPERTY(int expectedCount READ expectedCount NOTIFY loadingProgressChanged)
+    Q_PROPERTY(GstCatalogDiffModel* catalogDiffModel READ catalogDiffModel CONSTANT)
+    Q_PROPERTY(bool isComparing READ isComparing NOTIFY comparingChanged)
 
   public:
+    /**
+     * @enum SearchMode
+     * @brief What filterElements() matches its query against
+     */
+    enum SearchMode {
+        ElementSearch,  ///< Element names, classifications, descriptions and signals
+        PropertySearch, ///< Property names, types and flags, see GstPropertyIndex
+        CapsSearch      ///< Caps accepted by a pad template, see GstCapsIndex
+    };
+    Q_ENUM(SearchMode)
+
     /**
      * @brief Constructs a new GstElementBrowser
      * @param parent Parent QObject
@@ -44,13 +72,27 @@ class GstElementBrowser : public QObject {
     explicit GstElementBrowser(QObject* parent = nullptr);
 
     /**
-     * @brief Get list of available element names
-     * @return QStringList of element names
+     * @brief Get model of the elements passing the current filter
+     * @return Pointer to GstElementFilterModel, best match first while filtering
+     */
+    GstElementFilterModel* elementModel() {
+        return m_filterModel;
+    }
+
+    /**
+     * @brief Get what the element filter matches against
+     * @return Current search mode
      */
-    [[nodiscard]] QStringList elementNames() const {
-        return m_elementNames;
+    [[nodiscard]] SearchMode searchMode() const {
+        return m_searchMode;
     }
 
+    /**
+     * @brief Set what the element filter matches against, and filter again
+     * @param mode Search mode
+     */
+    void setSearchMode(SearchMode mode);
+
     /**
      * @brief Get currently selected element name
      * @return Selected element name
@@ -83,6 +125,18 @@ class GstElementBrowser : public QObject {
         return m_currentElement.m_author;
     }
 
+    /**
+     * @brief Get the plugin providing the current element
+     * @return Plugin name followed by version and license, e.g. "coreelements 1.22.0 (LGPL)"
+     */
+    [[nodiscard]] QString elementPlugin() const;
+
+    /**
+     * @brief Get URI handling capabilities of current element
+     * @return URI type and protocols, e.g. "source: file, http", empty if the element handles no URIs
+     */
+    [[nodiscard]] QString elementUriHandling() const;
+
     /**
      * @brief Get property model for current element
      * @return Pointer to GstPropertyModel
@@ -99,6 +153,22 @@ class GstElementBrowser : public QObject {
         return m_padModel;
     }
 
+    /**
+     * @brief Get signal model for current element
+     * @return Pointer to GstSignalModel
+     */
+    GstSignalModel* signalModel() {
+        return m_signalModel;
+    }
+
+    /**
+     * @brief Get model of the changes found by the last compareCatalogs()
+     * @return Pointer to GstCatalogDiffModel
+     */
+    GstCatalogDiffModel* catalogDiffModel() {
+        return m_diffModel;
+    }
+
     /**
      * @brief Check if element parsing is in progress
      * @return true if loading, false otherwise
@@ -107,6 +177,30 @@ class GstElementBrowser : public QObject {
         return m_isLoading;
     }
 
+    /**
+     * @brief Get number of elements parsed by the running refresh
+     * @return Parsed element count
+     */
+    [[nodiscard]] int loadedCount() const {
+        return m_loadedCount;
+    }
+
+    /**
+     * @brief Get expected number of elements for the running refresh
+     * @return Expected element count, 0 if unknown
+     */
+    [[nodiscard]] int expectedCount() const {
+        return m_expectedCount;
+    }
+
+    /**
+     * @brief Check if a catalog comparison is in progress
+     * @return true while compareCatalogs() is running
+     */
+    [[nodiscard]] bool isComparing() const {
+        return m_isComparing;
+    }
+
     /**
      * @brief Set the selected element
      * @param elementName Name of element to select
@@ -115,26 +209,98 @@ class GstElementBrowser : public QObject {
 
     /**
      * @brief Refresh the list of available elements
+     *
+     * Uses the on-disk catalog cache when it matches the installed plugins,
+     * and re-inspects only the changed plugins when a few of them differ.
+     *
+     * @param forceRescan true to ignore the cache and re-run gst-inspect-1.0
+     */
+    Q_INVOKABLE void refreshElements(bool forceRescan = false);
+
+    /**
+     * @brief Cancel a running refresh, keeping the elements parsed so far
      */
-    Q_INVOKABLE void refreshElements();
+    Q_INVOKABLE void cancelRefresh();
 
     /**
-     * @brief Filter elements by name or classification
+     * @brief Filter elements by name or classification, or as selected by the search mode
      * @param filter Filter string
      */
     Q_INVOKABLE void filterElements(const QString& filter);
 
-  signals:
     /**
-     * @brief Emitted when element names list changes
+     * @brief Find elements by their properties
+     *
+     * Answered from the property index, which is built in the background
+     * on the first property, caps or Links query; empty until then.
+     *
+     * @param query Property name prefixes and "type:" and "flag:" terms, e.g. "flag:controllable type:bool"
+     * @return Names of the elements with a property matching all terms, sorted alphabetically
+     */
+    Q_INVOKABLE QStringList searchProperties(const QString& query);
+
+    /**
+     * @brief Find elements with a pad template accepting caps
+     *
+     * Answered from the caps index, which is built in the background
+     * on the first property, caps or Links query; empty until then.
+     *
+     * @param query Optional "src"/"sink" and presence words followed by caps, e.g. "sink video/x-raw, format=NV12"
+     * @return Element names, highest rank first
+     */
+    Q_INVOKABLE QStringList searchCaps(const QString& query);
+
+    /**
+     * @brief Get the elements that can be linked after an element
+     *
+     * Answered from the precomputed compatibility graph, which is loaded
+     * or built in the background on the first property, caps or Links
+     * query; empty until then.
+     *
+     * @param elementName Upstream element
+     * @return Element names with a SINK pad template compatible with one of its SRC pad templates
+     */
+    Q_INVOKABLE QStringList downstreamElements(const QString& elementName);
+
+    /**
+     * @brief Get the elements that can be linked before an element
+     * @param elementName Downstream element
+     * @return Element names with a SRC pad template compatible with one of its SINK pad templates
+     */
+    Q_INVOKABLE QStringList upstreamElements(const QString& elementName);
+
+    /**
+     * @brief Propose a chain of elements linking a source element to a sink element
+     * @param sourceElement First element of the chain
+     * @param sinkElement Last element of the chain
+     * @return Element names from source to sink, empty if none was found within the search budget
+     */
+    Q_INVOKABLE QStringList autoplugPath(const QString& sourceElement, const QString& sinkElement);
+
+    /**
+     * @brief Compare two catalogs in the background and list the changes in catalogDiffModel
+     *
+     * Each catalog is a catalog dump written by gststudio-catalog or
+     * recorded gst-inspect-1.0 --print-all output; an empty URL stands for
+     * the catalog currently browsed. A comparison started while another is
+     * running replaces it.
+     *
+     * @param before Older catalog file
+     * @param after Newer catalog file
      */
-    void elementNamesChanged();
+    Q_INVOKABLE void compareCatalogs(const QUrl& before, const QUrl& after);
 
+  signals:
     /**
      * @brief Emitted when selected element changes
      */
     void selectedElementChanged();
 
+    /**
+     * @brief Emitted when the search mode changes
+     */
+    void searchModeChanged();
+
     /**
      * @brief Emitted when element details change
      */
@@ -145,12 +311,75 @@ class GstElementBrowser : public QObject {
      */
     void loadingChanged();
 
+    /**
+     * @brief Emitted when the number of parsed elements changes during loading
+     */
+    void loadingProgressChanged();
+
+    /**
+     * @brief Emitted when a refresh could not be completed
+     * @param errorMessage Human-readable reason
+     */
+    void loadingFailed(const QString& errorMessage);
+
+    /**
+     * @brief Emitted when the compatibility graph and the property and caps indexes have been rebuilt or dropped
+     */
+    void compatibilityGraphChanged();
+
+    /**
+     * @brief Emitted when a catalog comparison starts or ends
+     */
+    void comparingChanged();
+
+    /**
+     * @brief Emitted when a catalog comparison could not be completed
+     * @param errorMessage Human-readable reason
+     */
+    void comparisonFailed(const QString& errorMessage);
+
   private slots:
     /**
      * @brief Called when element parsing is finished
      */
     void onParsingFinished();
 
+    /**
+     * @brief Called when element parsing failed or was cancelled
+     * @param errorMessage Human-readable reason
+     */
+    void onParsingFailed(const QString& errorMessage);
+
+    /**
+     * @brief Called when the parser reports progress
+     * @param current Number of elements parsed
+     * @param total Expected number of elements, 0 if unknown
+     */
+    void onParsingProgress(int current, int total);
+
+    /**
+     * @brief Called when the parser replaced its catalog as a whole
+     */
+    void onCatalogReset();
+
+    /**
+     * @brief Called when an incremental refresh adds an element
+     * @param elementName Name of the added element
+     */
+    void onElementAdded(const QString& elementName);
+
+    /**
+     * @brief Called when an incremental refresh removes an element
+     * @param elementName Name of the removed element
+     */
+    void onElementRemoved(const QString& elementName);
+
+    /**
+     * @brief Called when an incremental refresh re-inspects an element
+     * @param elementName Name of the updated element
+     */
+    void onElementUpdated(const QString& elementName);
+
     /**
      * @brief Called when a single element is parsed
      * @param elementName Name of the parsed element
@@ -158,19 +387,67 @@ class GstElementBrowser : public QObject {
     void onElementParsed(const QString& elementName);
 
   private:
-    GstInspectParser* m_parser;         ///< Parser for GStreamer elements
-    GstPropertyModel* m_propertyModel;  ///< Model for element properties
-    GstPadModel* m_padModel;            ///< Model for element pad templates
-    QStringList m_elementNames;         ///< List of all element names
-    QStringList m_filteredElementNames; ///< Filtered element names
-    QString m_selectedElement;          ///< Currently selected element
-    GstElement m_currentElement;        ///< Current element details
-    bool m_isLoading = false;           ///< Loading state
+    GstInspectParser* m_parser;                 ///< Parser for GStreamer elements
+    GstPropertyModel* m_propertyModel;          ///< Model for element properties
+    GstPadModel* m_padModel;                    ///< Model for element pad templates
+    GstSignalModel* m_signalModel;              ///< Model for element signals and actions
+    GstCatalogDiffModel* m_diffModel;           ///< Changes found by the last catalog comparison
+    GstElementListModel* m_elementModel;        ///< Model of all elements
+    GstElementFilterModel* m_filterModel;       ///< Search result view on m_elementModel
+    QStringList m_elementNames;                 ///< List of all element names
+    QString m_filter;                           ///< Current filter string
+    SearchMode m_searchMode = ElementSearch;    ///< What m_filter is matched against
+    GstElementIndex m_index;                    ///< Search index over all elements
+    bool m_elementsCurrent = false;             ///< Whether list model and index reflect the parser catalog
+    QString m_selectedElement;                  ///< Currently selected element
+    GstElement m_currentElement;                ///< Current element details
+    bool m_isLoading = false;                   ///< Loading state
+    int m_loadedCount = 0;                      ///< Elements parsed by the running refresh
+    int m_expectedCount = 0;                    ///< Expected elements for the running refresh, 0 if unknown
+    GstCompatibilityGraph m_compatibilityGraph; ///< Links between compatible pad templates
+    GstPropertyIndex m_propertyIndex;           ///< Elements by property name, type and flags
+    GstCapsIndex m_capsIndex;                   ///< Pad templates by media type, features and field values
+    int m_indexGeneration = 0;                  ///< Incremented per index rebuild to drop stale results
+    bool m_indexesInUse = false;                ///< Whether a query asked for the graph or the indexes
+    bool m_indexesCurrent = false;              ///< Whether the graph and indexes reflect the parser catalog
+    bool m_isComparing = false;                 ///< Whether a catalog comparison is running
+    int m_comparisonGeneration = 0;             ///< Incremented per comparison to drop stale results
 
     /**
      * @brief Update element details for current selection
      */
     void updateElementDetails();
+
+    /**
+     * @brief Bring the list model and search index up to date once a refresh ends
+     */
+    void finishRefresh();
+
+    /**
+     * @brief Start building the graph and the indexes on their first use
+     */
+    void requestCatalogIndexes();
+
+    /**
+     * @brief Drop the graph and the indexes after the catalog changed
+     */
+    void invalidateCatalogIndexes();
+
+    /**
+     * @brief Rebuild the property and caps indexes and load or rebuild the compatibility graph in the background
+     * @param completeCatalog Whether the catalog is complete; the graph of a partial one is neither loaded nor stored
+     */
+    void rebuildCatalogIndexes(bool completeCatalog);
+
+    /**
+     * @brief Parse the details of the elements listed around the selection in the background
+     */
+    void prefetchNeighbours();
+
+    /**
+     * @brief Load the factory details of all elements into the list model and search index
+     */
+    void reloadElements();
 };
 
 } // namespace GstStudio
@@ -0,0 +1,107 @@
+#include "gstelementfiltermodel.h"
+#include <limits>
+
+namespace GstStudio {
+
+GstStudio::GstElementFilterModel::GstElementFilterModel(QObject* parent) : QSortFilterProxyModel(parent) {
+    setSortRole(GstElementListModel::NameRole);
+}
+
+void GstStudio::GstElementFilterModel::setMatches(const QStringList& names,
+                                                  const QHash<QString, QStringList>& details) {
+    const bool hadDetails = !m_matchDetails.isEmpty();
+    m_matchDetails = details;
+    m_matchRanks.clear();
+    m_matchRanks.reserve(names.size());
+    for (int i = 0; i < names.size(); ++i) {
+        m_matchRanks.insert(names.at(i), i);
+    }
+    m_filtering = true;
+
+    // Filter changes are applied as row removals and insertions, the new order as a layout change.
+    // sort() returns early if the sort column is unchanged, although the ranks of kept rows changed
+    invalidateFilter();
+    if (sortColumn() == 0) {
+        invalidate();
+    } else {
+        sort(0);
+    }
+
+    // Rows kept from the previous result may have matched something else
+    if (hadDetails || !m_matchDetails.isEmpty()) {
+        emitMatchDetailsChanged();
+    }
+}
+
+void GstStudio::GstElementFilterModel::clearMatches() {
+    if (!m_filtering) {
+        return;
+    }
+
+    const bool hadDetails = !m_matchDetails.isEmpty();
+    m_matchRanks.clear();
+    m_matchDetails.clear();
+    m_filtering = false;
+    invalidateFilter();
+
+    // The source model is already sorted by name
+    sort(-1);
+
+    if (hadDetails) {
+        emitMatchDetailsChanged();
+    }
+}
+
+QString GstStudio::GstElementFilterModel::nameAt(int row) const {
+    return data(index(row, 0), GstElementListModel::NameRole).toString();
+}
+
+int GstStudio::GstElementFilterModel::rowOf(const QString& name) const {
+    const auto* source = qobject_cast<const GstElementListModel*>(sourceModel());
+    if (source == nullptr) {
+        return -1;
+    }
+
+    const int sourceRow = source->rowOf(name);
+    return sourceRow < 0 ? -1 : mapFromSource(source->index(sourceRow)).row();
+}
+
+QVariant GstStudio::GstElementFilterModel::data(const QModelIndex& index, int role) const {
+    if (role == MatchDetailsRole) {
+        return index.isValid() ? m_matchDetails.value(nameAt(index.row())) : QStringList();
+    }
+    return QSortFilterProxyModel::data(index, role);
+}
+
+QHash<int, QByteArray> GstStudio::GstElementFilterModel::roleNames() const {
+    QHash<int, QByteArray> roles = QSortFilterProxyModel::roleNames();
+    roles[MatchDetailsRole] = "matchDetails";
+    return roles;
+}
+
+void GstStudio::GstElementFilterModel::emitMatchDetailsChanged() {
+    if (rowCount() > 0) {
+        emit dataChanged(index(0, 0), index(rowCount() - 1, 0), {MatchDetailsRole});
+    }
+}
+
+bool GstStudio::GstElementFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const {
+    if (!m_filtering) {
+        return true;
+    }
+
+    const QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+    return m_matchRanks.contains(index.data(GstElementListModel::NameRole).toString());
+}
+
+bool GstStudio::GstElementFilterModel::lessThan(const QModelIndex& left, const QModelIndex& right) const {
+    const QString leftName = left.data(GstElementListModel::NameRole).toString();
+    const QString rightName = right.data(GstElementListModel::NameRole).toString();
+    if (!m_filtering) {
+        return leftName < rightName;
+    }
+    constexpr int kUnranked = std::numeric_limits<int>::max();
+    return m_matchRanks.value(leftName, kUnranked) < m_matchRanks.value(rightName, kUnranked);
+}
+
+} // namespace GstStudio
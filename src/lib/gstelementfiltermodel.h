@@ -0,0 +1,118 @@
+/**
+ * @file gstelementfiltermodel.h
+ * @brief Proxy model showing the search results of the element browser
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelementlistmodel.h"
+#include <QHash>
+#include <QQmlEngine>
+#include <QSortFilterProxyModel>
+#include <QStringList>
+
+namespace GstStudio {
+
+/**
+ * @class GstElementFilterModel
+ * @brief Proxy model showing the search results of the element browser
+ *
+ * The search itself is done by GstElementIndex; this proxy only hides the
+ * rows of the source GstElementListModel that are not part of the result
+ * and orders the remaining ones by rank. Changing the result removes and
+ * inserts rows instead of resetting the model, so unchanged delegates
+ * survive typing in the search field. Searches that know what matched in
+ * an element, such as property or caps searches, hand it over with the
+ * result; it is served through MatchDetailsRole, so delegates need not
+ * run the query again per row.
+ */
+class GstElementFilterModel : public QSortFilterProxyModel {
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by GstElementBrowser")
+
+  public:
+    /**
+     * @enum FilterRoles
+     * @brief Roles added to those of GstElementListModel
+     */
+    enum FilterRoles {
+        MatchDetailsRole = GstElementListModel::RankRole + 1 ///< What matched in the element, as a string list
+    };
+
+    /**
+     * @brief Constructs a new GstElementFilterModel
+     * @param parent Parent QObject
+     */
+    explicit GstElementFilterModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Show only the given elements, in the given order
+     * @param names Search result, best match first
+     * @param details Element name to what matched in it, e.g. property names; may be empty
+     */
+    void setMatches(const QStringList& names, const QHash<QString, QStringList>& details = {});
+
+    /**
+     * @brief Show all elements sorted by name
+     */
+    void clearMatches();
+
+    /**
+     * @brief Get the name of the element in a proxy row
+     * @param row Proxy row
+     * @return Element name, empty if the row is out of range
+     */
+    [[nodiscard]] QString nameAt(int row) const;
+
+    /**
+     * @brief Find the proxy row of an element
+     * @param name Element name
+     * @return Proxy row, or -1 if the element is hidden or not listed
+     */
+    [[nodiscard]] int rowOf(const QString& name) const;
+
+    /**
+     * @brief Get data for a proxy row, including the match details of the search result
+     * @param index Proxy index
+     * @param role Data role
+     * @return Data for the role
+     */
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Get role names for QML, those of the source model plus matchDetails
+     * @return Hash of role IDs to role names
+     */
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+  protected:
+    /**
+     * @brief Check whether a source row is part of the search result
+     * @param sourceRow Row in the source model
+     * @param sourceParent Parent index in the source model (unused)
+     * @return true if the row is shown
+     */
+    [[nodiscard]] bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
+
+    /**
+     * @brief Order rows by their position in the search result
+     * @param left Source index of the first row
+     * @param right Source index of the second row
+     * @return true if @p left ranks before @p right
+     */
+    [[nodiscard]] bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
+
+  private:
+    QHash<QString, int> m_matchRanks;           ///< Element name to position in the search result
+    QHash<QString, QStringList> m_matchDetails; ///< Element name to what matched in it
+    bool m_filtering = false;                   ///< Whether a search result is applied
+
+    /**
+     * @brief Notify views that the match details of all rows may have changed
+     */
+    void emitMatchDetailsChanged();
+};
+
+} // namespace GstStudio
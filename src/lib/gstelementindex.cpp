@@ -0,0 +1,334 @@
+#include "gstelementindex.h"
+#include <QStringTokenizer>
+#include <algorithm>
+#include <iterator>
+
+namespace GstStudio {
+
+namespace {
+
+/// Terms shorter than this are only matched against element names
+constexpr qsizetype kTrigramLength = 3;
+
+/// Score of a term by the field it occurs in
+constexpr int kExactNameScore = 100;
+constexpr int kNamePrefixScore = 80;
+constexpr int kNameScore = 60;
+constexpr int kLongNameScore = 40;
+constexpr int kKlassScore = 30;
+constexpr int kDescriptionScore = 20;
+constexpr int kSignalScore = 10;
+
+QList<int> intersect(const QList<int>& first, const QList<int>& second) {
+    QList<int> result;
+    result.reserve(std::min(first.size(), second.size()));
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(result));
+    return result;
+}
+
+qsizetype lastTermLength(const QString& query) {
+    return query.size() - (query.lastIndexOf(u' ') + 1);
+}
+
+} // namespace
+
+void GstStudio::GstElementIndex::clear() {
+    m_documents.clear();
+    m_ids.clear();
+    m_postings.clear();
+    m_lastQuery.clear();
+    m_lastMatches.clear();
+    m_lastQueryValid = false;
+}
+
+void GstStudio::GstElementIndex::insert(const GstElement& element) {
+    const auto existing = m_ids.constFind(element.m_name);
+    if (existing != m_ids.constEnd()) {
+        m_documents[existing.value()].m_alive = false;
+    }
+
+    Document document;
+    document.m_name = element.m_name;
+    document.m_foldedName = element.m_name.toCaseFolded();
+    document.m_foldedLongName = element.m_longName.toCaseFolded();
+    document.m_foldedKlass = element.m_classification.toCaseFolded();
+    document.m_foldedDesc = element.m_description.toCaseFolded();
+    for (const GstSignal& descriptor : element.m_signals) {
+        document.m_foldedSignals += descriptor.m_name.toCaseFolded();
+        document.m_foldedSignals += u'\n';
+    }
+
+    const int id = static_cast<int>(m_documents.size());
+    m_documents.append(document);
+    m_ids.insert(element.m_name, id);
+    indexDocument(id);
+    m_lastQueryValid = false;
+
+    if (m_documents.size() > 2 * m_ids.size()) {
+        compact();
+    }
+}
+
+void GstStudio::GstElementIndex::remove(const QString& name) {
+    const auto it = m_ids.constFind(name);
+    if (it == m_ids.constEnd()) {
+        return;
+    }
+
+    m_documents[it.value()].m_alive = false;
+    m_ids.erase(it);
+    m_lastQueryValid = false;
+
+    // Removed documents stay in the postings until they outnumber the live ones
+    if (m_documents.size() > 2 * m_ids.size()) {
+        compact();
+    }
+}
+
+QStringList GstStudio::GstElementIndex::search(const QString& query, int limit) {
+    const QString folded = query.toCaseFolded().simplified();
+    if (folded.isEmpty()) {
+        m_lastQueryValid = false;
+        QStringList names = m_ids.keys();
+        std::sort(names.begin(), names.end());
+        if (limit >= 0 && names.size() > limit) {
+            names.resize(limit);
+        }
+        return names;
+    }
+
+    QList<QStringView> terms;
+    for (QStringView term : qTokenize(folded, u' ')) {
+        terms.append(term);
+    }
+
+    // Extending the previous query can only drop matches, unless its last term just grew long
+    // enough to be matched beyond the element name
+    const bool narrows = m_lastQueryValid && folded.startsWith(m_lastQuery) &&
+                         (folded.size() == m_lastQuery.size() || folded.at(m_lastQuery.size()) == u' ' ||
+                          lastTermLength(m_lastQuery) >= kTrigramLength);
+
+    QList<int> pool;
+    if (narrows) {
+        pool = m_lastMatches;
+    } else {
+        pool = candidates(terms.first());
+        for (qsizetype i = 1; i < terms.size() && !pool.isEmpty(); ++i) {
+            pool = intersect(pool, candidates(terms.at(i)));
+        }
+    }
+
+    QList<std::pair<int, int>> matches; // id, score
+    for (int id : std::as_const(pool)) {
+        const Document& document = m_documents.at(id);
+        if (!document.m_alive) {
+            continue;
+        }
+
+        int score = 0;
+        for (QStringView term : std::as_const(terms)) {
+            const int termMatch = termScore(document, term);
+            if (termMatch == 0) {
+                score = 0;
+                break;
+            }
+            score += termMatch;
+        }
+        if (score > 0) {
+            matches.append({id, score});
+        }
+    }
+
+    m_lastQuery = folded;
+    m_lastMatches.clear();
+    m_lastMatches.reserve(matches.size());
+    for (const auto& match : std::as_const(matches)) {
+        m_lastMatches.append(match.first);
+    }
+    m_lastQueryValid = true;
+
+    QList<int> ranked;
+    if (matches.isEmpty()) {
+        ranked = fuzzyMatches(terms);
+    } else {
+        std::sort(matches.begin(), matches.end(), [this](const auto& a, const auto& b) {
+            if (a.second != b.second) {
+                return a.second > b.second;
+            }
+            const QString& nameA = m_documents.at(a.first).m_name;
+            const QString& nameB = m_documents.at(b.first).m_name;
+            return nameA.size() != nameB.size() ? nameA.size() < nameB.size() : nameA < nameB;
+        });
+        ranked.reserve(matches.size());
+        for (const auto& match : std::as_const(matches)) {
+            ranked.append(match.first);
+        }
+    }
+
+    if (limit >= 0 && ranked.size() > limit) {
+        ranked.resize(limit);
+    }
+
+    QStringList names;
+    names.reserve(ranked.size());
+    for (int id : std::as_const(ranked)) {
+        names.append(m_documents.at(id).m_name);
+    }
+    return names;
+}
+
+void GstStudio::GstElementIndex::compact() {
+    QList<Document> documents;
+    documents.reserve(m_ids.size());
+    for (const Document& document : std::as_const(m_documents)) {
+        if (document.m_alive) {
+            documents.append(document);
+        }
+    }
+
+    m_documents = documents;
+    m_ids.clear();
+    m_postings.clear();
+    for (int id = 0; id < m_documents.size(); ++id) {
+        m_ids.insert(m_documents.at(id).m_name, id);
+        indexDocument(id);
+    }
+}
+
+void GstStudio::GstElementIndex::indexDocument(int id) {
+    const Document& document = m_documents.at(id);
+    QList<quint64> keys;
+
+    const QStringView name = document.m_foldedName;
+    for (qsizetype i = 0; i < name.size(); ++i) {
+        keys.append(gramKey(name.sliced(i, 1)));
+        if (i + 2 <= name.size()) {
+            keys.append(gramKey(name.sliced(i, 2)));
+        }
+    }
+
+    for (QStringView field : {QStringView(document.m_foldedName), QStringView(document.m_foldedLongName),
+                              QStringView(document.m_foldedKlass), QStringView(document.m_foldedDesc),
+                              QStringView(document.m_foldedSignals)}) {
+        for (qsizetype i = 0; i + kTrigramLength <= field.size(); ++i) {
+            keys.append(gramKey(field.sliced(i, kTrigramLength)));
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // Ids are handed out in ascending order, so appending keeps every posting list sorted
+    for (quint64 key : std::as_const(keys)) {
+        m_postings[key].append(id);
+    }
+}
+
+QList<int> GstStudio::GstElementIndex::candidates(QStringView term) const {
+    if (term.size() < kTrigramLength) {
+        return m_postings.value(gramKey(term));
+    }
+
+    QList<const QList<int>*> postings;
+    for (qsizetype i = 0; i + kTrigramLength <= term.size(); ++i) {
+        const auto it = m_postings.constFind(gramKey(term.sliced(i, kTrigramLength)));
+        if (it == m_postings.constEnd()) {
+            return {};
+        }
+        postings.append(&it.value());
+    }
+
+    // Intersect starting from the rarest trigram to keep intermediate results small
+    std::sort(postings.begin(), postings.end(), [](const QList<int>* a, const QList<int>* b) {
+        return a->size() < b->size();
+    });
+
+    QList<int> result = *postings.first();
+    for (qsizetype i = 1; i < postings.size() && !result.isEmpty(); ++i) {
+        result = intersect(result, *postings.at(i));
+    }
+    return result;
+}
+
+int GstStudio::GstElementIndex::termScore(const Document& document, QStringView term) {
+    if (document.m_foldedName == term) {
+        return kExactNameScore;
+    }
+    if (document.m_foldedName.startsWith(term)) {
+        return kNamePrefixScore;
+    }
+    if (document.m_foldedName.contains(term)) {
+        return kNameScore;
+    }
+    if (term.size() < kTrigramLength) {
+        return 0;
+    }
+    if (document.m_foldedLongName.contains(term)) {
+        return kLongNameScore;
+    }
+    if (document.m_foldedKlass.contains(term)) {
+        return kKlassScore;
+    }
+    if (document.m_foldedDesc.contains(term)) {
+        return kDescriptionScore;
+    }
+    if (document.m_foldedSignals.contains(term)) {
+        return kSignalScore;
+    }
+    return 0;
+}
+
+QList<int> GstStudio::GstElementIndex::fuzzyMatches(const QList<QStringView>& terms) const {
+    QList<quint64> keys;
+    for (QStringView term : terms) {
+        for (qsizetype i = 0; i + kTrigramLength <= term.size(); ++i) {
+            keys.append(gramKey(term.sliced(i, kTrigramLength)));
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    if (keys.isEmpty()) {
+        return {};
+    }
+
+    QHash<int, int> hits;
+    for (quint64 key : std::as_const(keys)) {
+        for (int id : m_postings.value(key)) {
+            if (m_documents.at(id).m_alive) {
+                ++hits[id];
+            }
+        }
+    }
+
+    const int threshold = static_cast<int>((keys.size() + 1) / 2);
+    QList<std::pair<int, int>> matches; // id, shared trigrams
+    for (auto it = hits.constBegin(); it != hits.constEnd(); ++it) {
+        if (it.value() >= threshold) {
+            matches.append({it.key(), it.value()});
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), [this](const auto& a, const auto& b) {
+        if (a.second != b.second) {
+            return a.second > b.second;
+        }
+        return m_documents.at(a.first).m_name < m_documents.at(b.first).m_name;
+    });
+
+    QList<int> ranked;
+    ranked.reserve(matches.size());
+    for (const auto& match : std::as_const(matches)) {
+        ranked.append(match.first);
+    }
+    return ranked;
+}
+
+quint64 GstStudio::GstElementIndex::gramKey(QStringView gram) {
+    quint64 key = static_cast<quint64>(gram.size()) << 48;
+    for (qsizetype i = 0; i < gram.size() && i < kTrigramLength; ++i) {
+        key |= static_cast<quint64>(gram.at(i).unicode()) << (16 * (2 - i));
+    }
+    return key;
+}
+
+} // namespace GstStudio
@@ -0,0 +1,129 @@
+/**
+ * @file gstelementindex.h
+ * @brief N-gram search index over the element catalog
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @class GstElementIndex
+ * @brief N-gram search index over the element catalog
+ *
+ * Name, long name, classification, description and signal names of every
+ * element are case-folded and split into trigrams; names are additionally indexed by
+ * their single characters and bigrams so one- and two-letter queries narrow
+ * through the index too. A query is split at whitespace into terms that must
+ * all match. Candidates come from intersecting the posting lists of each
+ * term and are verified against the folded text, so results are exact
+ * substring matches ranked by where they matched. When nothing matches
+ * exactly, elements sharing most of the query trigrams are returned instead,
+ * which tolerates typos.
+ *
+ * Typing usually extends the previous query; in that case only the previous
+ * matches are verified again instead of going back to the posting lists.
+ */
+class GstElementIndex {
+  public:
+    /**
+     * @brief Remove all elements
+     */
+    void clear();
+
+    /**
+     * @brief Add an element, replacing an indexed element of the same name
+     * @param element Element to index; only the factory details and signals are used
+     */
+    void insert(const GstElement& element);
+
+    /**
+     * @brief Remove an element
+     * @param name Element name
+     */
+    void remove(const QString& name);
+
+    /**
+     * @brief Get number of indexed elements
+     * @return Element count
+     */
+    [[nodiscard]] int size() const {
+        return static_cast<int>(m_ids.size());
+    }
+
+    /**
+     * @brief Find elements matching a query
+     * @param query Whitespace-separated terms, matched case-insensitively
+     * @param limit Maximum number of results, -1 for all
+     * @return Element names, best match first; all names sorted alphabetically for an empty query
+     */
+    QStringList search(const QString& query, int limit = -1);
+
+  private:
+    struct Document {
+        QString m_name;           ///< Element name as indexed
+        QString m_foldedName;     ///< Case-folded name
+        QString m_foldedLongName; ///< Case-folded long name
+        QString m_foldedKlass;    ///< Case-folded classification
+        QString m_foldedDesc;     ///< Case-folded description
+        QString m_foldedSignals;  ///< Case-folded signal and action names, one per line
+        bool m_alive = true;      ///< false once removed or replaced
+    };
+
+    QList<Document> m_documents;           ///< Documents by id, including removed ones
+    QHash<QString, int> m_ids;             ///< Element name to id of its live document
+    QHash<quint64, QList<int>> m_postings; ///< N-gram key to ascending document ids
+    QString m_lastQuery;                   ///< Case-folded previous query
+    QList<int> m_lastMatches;              ///< Ascending ids of the exact matches of m_lastQuery
+    bool m_lastQueryValid = false;         ///< Whether m_lastMatches reflects the current documents
+
+    /**
+     * @brief Rebuild the postings without removed documents
+     */
+    void compact();
+
+    /**
+     * @brief Add the postings of a document
+     * @param id Document id
+     */
+    void indexDocument(int id);
+
+    /**
+     * @brief Get ids of documents that may contain a term
+     * @param term Case-folded term
+     * @return Ascending document ids, a superset of the exact matches
+     */
+    [[nodiscard]] QList<int> candidates(QStringView term) const;
+
+    /**
+     * @brief Score how well a document matches a term
+     * @param document Indexed document
+     * @param term Case-folded term
+     * @return Score, 0 if the term does not occur in the document
+     */
+    static int termScore(const Document& document, QStringView term);
+
+    /**
+     * @brief Rank documents by the share of query trigrams they contain
+     * @param terms Case-folded terms
+     * @return Ids of documents sharing at least half of the trigrams, best first
+     */
+    [[nodiscard]] QList<int> fuzzyMatches(const QList<QStringView>& terms) const;
+
+    /**
+     * @brief Pack an n-gram into a posting key
+     * @param gram One to three characters
+     * @return Key distinct for every n-gram
+     */
+    static quint64 gramKey(QStringView gram);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,103 @@
+#include "gstelementlistmodel.h"
+#include <algorithm>
+
+namespace GstStudio {
+
+GstStudio::GstElementListModel::GstElementListModel(QObject* parent) : QAbstractListModel(parent) {
+}
+
+int GstStudio::GstElementListModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(m_entries.size());
+}
+
+QVariant GstStudio::GstElementListModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_entries.size()) {
+        return {};
+    }
+
+    const Entry& entry = m_entries.at(index.row());
+
+    switch (role) {
+        case Qt::DisplayRole:
+        case NameRole:
+            return entry.m_name;
+        case LongNameRole:
+            return entry.m_longName;
+        case ClassificationRole:
+            return entry.m_classification;
+        case RankRole:
+            return entry.m_rank;
+        default:
+            return {};
+    }
+}
+
+QHash<int, QByteArray> GstStudio::GstElementListModel::roleNames() const {
+    QHash<int, QByteArray> roles;
+    roles[NameRole] = "name";
+    roles[LongNameRole] = "longName";
+    roles[ClassificationRole] = "classification";
+    roles[RankRole] = "rank";
+    return roles;
+}
+
+void GstStudio::GstElementListModel::setElements(const QList<GstElement>& elements) {
+    beginResetModel();
+    m_entries.clear();
+    m_entries.reserve(elements.size());
+    for (const GstElement& element : elements) {
+        m_entries.append(entry(element));
+    }
+    std::sort(m_entries.begin(), m_entries.end(),
+              [](const Entry& a, const Entry& b) { return a.m_name < b.m_name; });
+    endResetModel();
+}
+
+void GstStudio::GstElementListModel::insertElement(const GstElement& element) {
+    const int row = lowerBound(element.m_name);
+    if (row < m_entries.size() && m_entries.at(row).m_name == element.m_name) {
+        m_entries[row] = entry(element);
+        const QModelIndex changed = index(row);
+        emit dataChanged(changed, changed);
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), row, row);
+    m_entries.insert(row, entry(element));
+    endInsertRows();
+}
+
+void GstStudio::GstElementListModel::removeElement(const QString& name) {
+    const int row = rowOf(name);
+    if (row < 0) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_entries.removeAt(row);
+    endRemoveRows();
+}
+
+int GstStudio::GstElementListModel::rowOf(const QString& name) const {
+    const int row = lowerBound(name);
+    return row < m_entries.size() && m_entries.at(row).m_name == name ? row : -1;
+}
+
+QString GstStudio::GstElementListModel::nameAt(int row) const {
+    return row >= 0 && row < m_entries.size() ? m_entries.at(row).m_name : QString();
+}
+
+int GstStudio::GstElementListModel::lowerBound(const QString& name) const {
+    const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), name,
+                                     [](const Entry& entry, const QString& value) { return entry.m_name < value; });
+    return static_cast<int>(it - m_entries.begin());
+}
+
+GstStudio::GstElementListModel::Entry GstStudio::GstElementListModel::entry(const GstElement& element) {
+    return {element.m_name, element.m_longName, element.m_classification, element.m_rank};
+}
+
+} // namespace GstStudio
@@ -0,0 +1,125 @@
+/**
+ * @file gstelementlistmodel.h
+ * @brief Qt model listing the discovered GStreamer elements
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QAbstractListModel>
+#include <QQmlEngine>
+
+namespace GstStudio {
+
+/**
+ * @class GstElementListModel
+ * @brief Qt model listing the discovered GStreamer elements
+ *
+ * Rows are kept sorted by element name. Single elements are inserted,
+ * removed and updated with row-level notifications, so views keep their
+ * delegates while the catalog is patched; only replacing the catalog as a
+ * whole resets the model.
+ */
+class GstElementListModel : public QAbstractListModel {
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by GstElementBrowser")
+
+  public:
+    /**
+     * @enum ElementRoles
+     * @brief Roles for accessing element data
+     */
+    enum ElementRoles {
+        NameRole = Qt::UserRole + 1, ///< Element name
+        LongNameRole,                ///< Human-readable element name
+        ClassificationRole,          ///< Element classification (Klass)
+        RankRole                     ///< Element rank as number, see GstElement::Rank
+    };
+
+    /**
+     * @brief Constructs a new GstElementListModel
+     * @param parent Parent QObject
+     */
+    explicit GstElementListModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Get number of elements
+     * @param parent Parent model index (unused)
+     * @return Number of elements
+     */
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    /**
+     * @brief Get data for a specific element
+     * @param index Model index
+     * @param role Data role
+     * @return QVariant containing requested data
+     */
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Get role names for QML access
+     * @return Hash of role names
+     */
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+    /**
+     * @brief Replace all elements
+     * @param elements Elements to list; only the factory details are used
+     */
+    void setElements(const QList<GstElement>& elements);
+
+    /**
+     * @brief Insert an element at its sorted position, or update it if already listed
+     * @param element Element to list
+     */
+    void insertElement(const GstElement& element);
+
+    /**
+     * @brief Remove an element
+     * @param name Element name
+     */
+    void removeElement(const QString& name);
+
+    /**
+     * @brief Find the row of an element
+     * @param name Element name
+     * @return Row, or -1 if the element is not listed
+     */
+    [[nodiscard]] int rowOf(const QString& name) const;
+
+    /**
+     * @brief Get the name of the element in a row
+     * @param row Row
+     * @return Element name, empty if the row is out of range
+     */
+    [[nodiscard]] QString nameAt(int row) const;
+
+  private:
+    struct Entry {
+        QString m_name;           ///< Element name
+        QString m_longName;       ///< Human-readable element name
+        QString m_classification; ///< Element classification
+        int m_rank = 0;           ///< Element rank
+    };
+
+    QList<Entry> m_entries; ///< Listed elements, sorted by name
+
+    /**
+     * @brief Find the first row whose name is not less than a name
+     * @param name Element name
+     * @return Insertion row
+     */
+    [[nodiscard]] int lowerBound(const QString& name) const;
+
+    /**
+     * @brief Copy the listed fields of an element
+     * @param element Element
+     * @return Model entry
+     */
+    static Entry entry(const GstElement& element);
+};
+
+} // namespace GstStudio
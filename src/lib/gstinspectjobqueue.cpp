@@ -0,0 +1,165 @@
+#include "gstinspectjobqueue.h"
+#include <QThread>
+#include <QTimer>
+#include <algorithm>
+
+#ifdef Q_OS_UNIX
+#include <locale.h>
+#endif
+
+namespace GstStudio {
+
+namespace {
+
+/// Whether the C library has the C.UTF-8 locale; glibc before 2.35 and some minimal images lack it
+bool hasUtf8CLocale() {
+#ifdef Q_OS_UNIX
+    static const bool available = [] {
+        locale_t locale = newlocale(LC_ALL_MASK, "C.UTF-8", nullptr);
+        if (locale == nullptr) {
+            return false;
+        }
+        freelocale(locale);
+        return true;
+    }();
+    return available;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+GstStudio::GstInspectJobQueue::GstInspectJobQueue(QObject* parent) : QObject(parent) {}
+
+void GstStudio::GstInspectJobQueue::enqueue(const QStringList& arguments) {
+    m_queue.append({arguments, false});
+    startJobs();
+}
+
+void GstStudio::GstInspectJobQueue::enqueueExclusive(const QStringList& arguments) {
+    m_queue.append({arguments, true});
+    startJobs();
+}
+
+void GstStudio::GstInspectJobQueue::cancel() {
+    m_queue.clear();
+    const QList<QProcess*> processes = m_running.keys();
+    m_running.clear();
+    m_timedOut.clear();
+    m_exclusive = nullptr;
+    for (QProcess* process : processes) {
+        // Reaping a hanging process must not block the GUI thread; the process deletes itself once it has exited
+        process->disconnect(this);
+        if (process->state() == QProcess::NotRunning) {
+            process->deleteLater();
+            continue;
+        }
+        connect(process, &QProcess::finished, process, &QObject::deleteLater);
+        process->kill();
+    }
+}
+
+bool GstStudio::GstInspectJobQueue::isRunning() const {
+    return !m_queue.isEmpty() || !m_running.isEmpty();
+}
+
+void GstStudio::GstInspectJobQueue::setMaxRunningJobs(int count) {
+    m_maxRunningJobs = count < 1 ? QThread::idealThreadCount() : count;
+    startJobs();
+}
+
+int GstStudio::GstInspectJobQueue::maxRunningJobs() const {
+    return m_maxRunningJobs;
+}
+
+void GstStudio::GstInspectJobQueue::setTimeout(int msecs) {
+    m_timeout = std::max(msecs, 0);
+}
+
+int GstStudio::GstInspectJobQueue::timeout() const {
+    return m_timeout;
+}
+
+QProcessEnvironment GstStudio::GstInspectJobQueue::inspectEnvironment() {
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+
+    // The UTF-8 variant keeps g_print() from replacing non-ASCII author names with '?' and has no
+    // translations either. Where it is missing, setlocale() would fail and leave the process in C
+    // anyway; naming C keeps the environment honest about that. LANGUAGE goes, since gettext may still
+    // honour it outside plain C
+    environment.insert(QStringLiteral("LC_ALL"), hasUtf8CLocale() ? QStringLiteral("C.UTF-8") : QStringLiteral("C"));
+    environment.remove(QStringLiteral("LANGUAGE"));
+
+    // Colors and the pager are only used on a terminal; rule them out for wrappers that fake one
+    environment.insert(QStringLiteral("GST_INSPECT_NO_COLORS"), QStringLiteral("1"));
+    environment.insert(QStringLiteral("NO_COLOR"), QStringLiteral("1"));
+    environment.insert(QStringLiteral("PAGER"), QStringLiteral("cat"));
+    return environment;
+}
+
+void GstStudio::GstInspectJobQueue::startJobs() {
+    while (m_exclusive == nullptr && m_running.size() < m_maxRunningJobs && !m_queue.isEmpty()) {
+        // An exclusive job waits for the running ones to complete
+        if (m_queue.first().m_exclusive && !m_running.isEmpty()) {
+            break;
+        }
+
+        const Job job = m_queue.takeFirst();
+        auto* process = new QProcess(this);
+        process->setStandardErrorFile(QProcess::nullDevice());
+        process->setProcessEnvironment(inspectEnvironment());
+        connect(process, &QProcess::finished, this, [this, process](int exitCode, QProcess::ExitStatus exitStatus) {
+            onProcessFinished(process, exitCode, exitStatus);
+        });
+        connect(process, &QProcess::errorOccurred, this, [this, process](QProcess::ProcessError error) {
+            // Crashes and kills are reported through finished(); only a failed start never reaches it
+            if (error == QProcess::FailedToStart) {
+                completeJob(process, false);
+            }
+        });
+
+        if (job.m_exclusive) {
+            m_exclusive = process;
+        } else if (m_timeout > 0) {
+            // The process is the context, so the timer goes away with the process; until its deferred
+            // deletion, a completed job is no longer in m_running
+            QTimer::singleShot(m_timeout, process, [this, process]() {
+                if (!m_running.contains(process)) {
+                    return;
+                }
+                m_timedOut.insert(process);
+                process->kill();
+            });
+        }
+
+        m_running.insert(process, job.m_arguments);
+        process->start("gst-inspect-1.0", job.m_arguments);
+    }
+}
+
+void GstStudio::GstInspectJobQueue::onProcessFinished(QProcess* process, int exitCode,
+                                                      QProcess::ExitStatus exitStatus) {
+    completeJob(process, exitStatus == QProcess::NormalExit && exitCode == 0);
+}
+
+void GstStudio::GstInspectJobQueue::completeJob(QProcess* process, bool success) {
+    const QStringList arguments = m_running.take(process);
+    const QByteArray output = process->readAllStandardOutput();
+    const bool timedOut = m_timedOut.remove(process);
+    if (process == m_exclusive) {
+        m_exclusive = nullptr;
+    }
+    process->disconnect(this);
+    process->deleteLater();
+
+    // Slots may queue follow-up jobs, which startJobs() below picks up
+    emit jobFinished(arguments, output, success && !timedOut);
+    startJobs();
+
+    if (!isRunning()) {
+        emit finished();
+    }
+}
+
+} // namespace GstStudio
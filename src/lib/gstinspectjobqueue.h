@@ -0,0 +1,166 @@
+/**
+ * @file gstinspectjobqueue.h
+ * @brief Queue of gst-inspect-1.0 invocations
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QSet>
+#include <QStringList>
+
+namespace GstStudio {
+
+/**
+ * @class GstInspectJobQueue
+ * @brief Queue of gst-inspect-1.0 invocations
+ *
+ * Runs gst-inspect-1.0 once per queued argument list, up to
+ * maxRunningJobs() processes at a time, and hands the complete standard
+ * output of each run back through jobFinished() in completion order. Jobs
+ * may be queued while the queue is running, including from a slot
+ * connected to jobFinished(). A job running longer than timeout() is
+ * killed and reported as failed, so a hanging plugin only loses its own
+ * results.
+ */
+class GstInspectJobQueue : public QObject {
+    Q_OBJECT
+
+  public:
+    /**
+     * @brief Constructs a new GstInspectJobQueue
+     * @param parent Parent QObject
+     */
+    explicit GstInspectJobQueue(QObject* parent = nullptr);
+
+    /**
+     * @brief Queue a gst-inspect-1.0 invocation
+     * @param arguments Command line arguments, e.g. an element name or plugin file
+     */
+    void enqueue(const QStringList& arguments);
+
+    /**
+     * @brief Queue a gst-inspect-1.0 invocation that runs alone and without the timeout
+     *
+     * The job starts once the jobs queued before it have completed, and
+     * jobs queued after it wait until it has completed. Lets a single
+     * process rebuild a stale GStreamer registry before many processes
+     * would each rebuild it in parallel.
+     *
+     * @param arguments Command line arguments, empty to only load the registry and list the plugins
+     */
+    void enqueueExclusive(const QStringList& arguments);
+
+    /**
+     * @brief Drop all queued jobs and kill the running ones
+     *
+     * Returns without waiting for the killed processes to exit; they are
+     * deleted once they have. Neither jobFinished() nor finished() is
+     * emitted for cancelled jobs.
+     */
+    void cancel();
+
+    /**
+     * @brief Check whether jobs are queued or running
+     * @return true until the queue has drained
+     */
+    [[nodiscard]] bool isRunning() const;
+
+    /**
+     * @brief Set the number of processes that may run at the same time
+     *
+     * Takes effect as running jobs complete; running jobs are never stopped.
+     *
+     * @param count Process count; values below 1 select QThread::idealThreadCount()
+     */
+    void setMaxRunningJobs(int count);
+
+    /**
+     * @brief Get the number of processes that may run at the same time
+     * @return Process count, 1 unless changed
+     */
+    [[nodiscard]] int maxRunningJobs() const;
+
+    /**
+     * @brief Set how long a single job may run before it is killed
+     * @param msecs Timeout in milliseconds; 0 lets jobs run indefinitely
+     */
+    void setTimeout(int msecs);
+
+    /**
+     * @brief Get how long a single job may run before it is killed
+     * @return Timeout in milliseconds, 0 if jobs run indefinitely
+     */
+    [[nodiscard]] int timeout() const;
+
+    /**
+     * @brief Get the environment every gst-inspect-1.0 process is started with
+     *
+     * The user's environment with the C locale forced, so flag names and
+     * other translated words are printed the same for every user, and with
+     * colors and the pager turned off. C.UTF-8 is used where the C library
+     * provides it, plain C otherwise.
+     *
+     * @return Process environment for gst-inspect-1.0
+     */
+    static QProcessEnvironment inspectEnvironment();
+
+  signals:
+    /**
+     * @brief Emitted when a single invocation has completed
+     * @param arguments Arguments the job was queued with
+     * @param output Complete standard output, partial if the job timed out
+     * @param success true if the process exited normally with code 0 before the timeout
+     */
+    void jobFinished(const QStringList& arguments, const QByteArray& output, bool success);
+
+    /**
+     * @brief Emitted when the last queued job has completed
+     */
+    void finished();
+
+  private:
+    /**
+     * @struct Job
+     * @brief Queued gst-inspect-1.0 invocation
+     */
+    struct Job {
+        QStringList m_arguments;  ///< Command line arguments
+        bool m_exclusive = false; ///< Whether the job runs alone and without the timeout
+    };
+
+    QList<Job> m_queue;                      ///< Jobs waiting to be started
+    QHash<QProcess*, QStringList> m_running; ///< Running processes with the arguments of their jobs
+    QSet<QProcess*> m_timedOut;              ///< Running processes killed for exceeding the timeout
+    QProcess* m_exclusive = nullptr;         ///< Process of the running exclusive job, if any
+    int m_maxRunningJobs = 1;                ///< Processes that may run at the same time
+    int m_timeout = 0;                       ///< Job timeout in milliseconds, 0 for none
+
+    /**
+     * @brief Start queued jobs until the running job limit is reached
+     */
+    void startJobs();
+
+    /**
+     * @brief Called when a running process finishes
+     * @param process Process of the job
+     * @param exitCode Process exit code
+     * @param exitStatus Process exit status
+     */
+    void onProcessFinished(QProcess* process, int exitCode, QProcess::ExitStatus exitStatus);
+
+    /**
+     * @brief Report a job as done and continue with the queue
+     * @param process Process of the job
+     * @param success Whether the job succeeded
+     */
+    void completeJob(QProcess* process, bool success);
+};
+
+} // namespace GstStudio
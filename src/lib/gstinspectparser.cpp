@@ -1,144 +1,841 @@
 #include "gstinspectparser.h"
+#include <QFileInfo>
+#include <QStringTokenizer>
+#include <QThread>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+#include <algorithm>
 #include <utility>
 
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+#include "gstregistrybackend.h"
+#endif
+
 namespace GstStudio {
 
-GstStudio::GstInspectParser::GstInspectParser(QObject* parent) : QObject(parent), m_process(new QProcess(this)) {
+namespace {
+
+/// Detail lines of a property are aligned far to the right of the property name column
+constexpr qsizetype kPropertyDetailIndent = 8;
+
+/// Inspecting a single plugin or element normally takes well below a second once the registry is current,
+/// which a warm-up run without the timeout ensures; a plugin still running after a few seconds is taken to hang
+constexpr int kDefaultInspectTimeout = 5000;
+
+/// Characters matched by \w, which is ASCII-only in QRegularExpression by default
+bool isWordChar(QChar c) {
+    return (c >= u'a' && c <= u'z') || (c >= u'A' && c <= u'Z') || (c >= u'0' && c <= u'9') || c == u'_';
+}
+
+bool isBlank(QChar c) {
+    return c == u' ' || c == u'\t';
+}
+
+qsizetype indentation(QStringView text) {
+    qsizetype indent = 0;
+    while (indent < text.size() && text.at(indent).isSpace()) {
+        ++indent;
+    }
+    return indent;
+}
+
+/// Split a header line like "Long-name                Fake Sink" at its first blank run
+bool splitHeaderField(QStringView line, QStringView& key, QStringView& value) {
+    qsizetype keyEnd = 0;
+    while (keyEnd < line.size() && !isBlank(line.at(keyEnd))) {
+        ++keyEnd;
+    }
+    key = line.first(keyEnd);
+    value = line.sliced(keyEnd).trimmed();
+    return keyEnd > 0 && !value.isEmpty();
+}
+
+/// The rank name may carry an offset ("primary + 1 (257)"), the number in parentheses is exact
+bool parseRank(QStringView value, int& rank) {
+    const qsizetype open = value.indexOf(u'(');
+    const qsizetype close = open < 0 ? -1 : value.indexOf(u')', open + 1);
+    if (close <= open + 1) {
+        return false;
+    }
+
+    const QStringView digits = value.sliced(open + 1, close - open - 1);
+    if (!std::all_of(digits.begin(), digits.end(), [](QChar c) { return c >= u'0' && c <= u'9'; })) {
+        return false;
+    }
+    rank = digits.toInt();
+    return true;
+}
+
+/// Flag names as printed in the C locale, which every gst-inspect-1.0 process is started in. Recorded output
+/// loaded through loadOutput(), gststudio-catalog --input or a catalog comparison may have been captured under
+/// a translated locale, so the known translations map to the same flags; this is a fallback for such
+/// recordings, not a second way of running gst-inspect-1.0
+constexpr std::pair<QStringView, GstProperty::Flag> kPropertyFlagTokens[] = {
+    {u"readable", GstProperty::Readable},         {u"writable", GstProperty::Writable},
+    {u"controllable", GstProperty::Controllable}, {u"lesbar", GstProperty::Readable},
+    {u"schreibbar", GstProperty::Writable},       {u"steuerbar", GstProperty::Controllable}};
+
+/// Flags of a flags line body like "readable, writable, controllable"; tokens without a flag, such as
+/// "deprecated" or the parts of "changeable in NULL, READY, PAUSED or PLAYING state", are skipped
+GstProperty::Flags parsePropertyFlags(QStringView tokens) {
+    GstProperty::Flags flags;
+    for (QStringView token : qTokenize(tokens, u',')) {
+        token = token.trimmed();
+        for (const auto& [name, flag] : kPropertyFlagTokens) {
+            if (token == name) {
+                flags |= flag;
+                break;
+            }
+        }
+    }
+    return flags;
+}
+
+/// Spell a C type the same way whatever the spacing, "GstSample *" and "GstSample*" become "GstSample*"
+QString signalType(QStringView text) {
+    QString type;
+    type.reserve(text.size());
+    for (QChar c : text.trimmed()) {
+        if (c == u'*') {
+            while (type.endsWith(u' ')) {
+                type.chop(1);
+            }
+        }
+        type += c;
+    }
+    return type;
+}
+
+/// Split a declaration joined into one line, like
+/// "handoff" :  void user_function (GstElement* object, GstBuffer* arg0, GstPad* arg1, gpointer user_data);
+/// into name, return type and the argument types between the object and user_data
+bool parseSignalDeclaration(QStringView declaration, GstSignal& descriptor) {
+    const qsizetype nameEnd = declaration.indexOf(u'"', 1);
+    const qsizetype open = nameEnd < 0 ? -1 : declaration.indexOf(u'(', nameEnd);
+    const qsizetype close = declaration.lastIndexOf(u')');
+    if (nameEnd <= 1 || open < 0 || close < open) {
+        return false;
+    }
+
+    // Between the colon and the parenthesis are the return type and a placeholder function name
+    QStringView prototype = declaration.sliced(nameEnd + 1, open - nameEnd - 1).trimmed();
+    if (!prototype.startsWith(u':')) {
+        return false;
+    }
+    prototype = prototype.sliced(1).trimmed();
+    const qsizetype functionStart = prototype.lastIndexOf(u' ');
+    if (functionStart < 0) {
+        return false;
+    }
+
+    descriptor.m_name = declaration.sliced(1, nameEnd - 1).toString();
+    descriptor.m_returnType = signalType(prototype.first(functionStart));
+
+    bool instance = true;
+    for (QStringView argument : qTokenize(declaration.sliced(open + 1, close - open - 1), u',')) {
+        argument = argument.trimmed();
+        const qsizetype nameStart = argument.lastIndexOf(u' ');
+        const QString type = signalType(nameStart < 0 ? argument : argument.first(nameStart));
+        if (instance) {
+            instance = false;
+        } else if (type != u"gpointer" || argument.sliced(nameStart + 1) != u"user_data") {
+            descriptor.m_argumentTypes.append(type);
+        }
+    }
+    return true;
+}
+
+/// Wrap a parse function so its results share the repetitive strings of the catalog they are merged into
+template <typename Input>
+auto interning(const std::shared_ptr<GstStringPool>& pool, GstElement (*parse)(const Input&)) {
+    return [pool, parse](const Input& input) {
+        GstElement element = parse(input);
+        pool->internElement(element);
+        return element;
+    };
+}
+
+} // namespace
+
+GstStudio::GstInspectParser::GstInspectParser(QObject* parent)
+    : QObject(parent), m_process(new QProcess(this)), m_threadPool(new QThreadPool(this)),
+      m_cacheFilePath(GstRegistryCache::defaultCacheFilePath()), m_jobQueue(new GstInspectJobQueue(this)),
+      m_stringPool(std::make_shared<GstStringPool>()) {
+    m_process->setProcessEnvironment(GstInspectJobQueue::inspectEnvironment());
     connect(m_process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this,
             &GstInspectParser::onProcessFinished);
+    connect(m_process, &QProcess::readyReadStandardOutput, this, &GstInspectParser::onReadyReadStandardOutput);
+    connect(m_process, &QProcess::errorOccurred, this, &GstInspectParser::onProcessErrorOccurred);
+    connect(m_jobQueue, &GstInspectJobQueue::jobFinished, this, &GstInspectParser::onJobFinished);
+    connect(m_jobQueue, &GstInspectJobQueue::finished, this, &GstInspectParser::onJobQueueFinished);
+
+    // Each inspection is a single-threaded process, so one per core keeps all of them busy
+    m_jobQueue->setMaxRunningJobs(QThread::idealThreadCount());
+    m_jobQueue->setTimeout(kDefaultInspectTimeout);
 }
 
-bool GstStudio::GstInspectParser::parseAllElements() {
-    QProcess process;
-    process.start("gst-inspect-1.0", QStringList() << "--print-all");
-    if (!process.waitForStarted()) {
+bool GstStudio::GstInspectParser::parseAllElements(bool useCache) {
+    if (isParsing()) {
         return false;
     }
 
-    if (!process.waitForFinished()) {
+    if (useCache && openCache()) {
+        if (m_catalog.fingerprint() == GstRegistryCache::currentFingerprint()) {
+            emit parsingProgress(m_catalog.elementCount(), m_catalog.elementCount());
+            emit parsingFinished();
+            return true;
+        }
+
+#ifndef GSTSTUDIO_HAVE_GST_REGISTRY
+        // The registry backend rescans everything faster than per-plugin inspections
+        if (startIncrementalRefresh()) {
+            return true;
+        }
+#endif
+    }
+
+    m_expectedCount = m_elements.isEmpty() ? m_catalog.elementCount() : static_cast<int>(m_elements.size());
+    resetCatalog();
+    m_catalog.close();
+    resetStreamState();
+    emit catalogReset();
+
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+    startRegistryScan();
+#else
+    if (m_discoveryMode == DiscoveryMode::PerPlugin) {
+        startPluginScan();
+        return true;
+    }
+
+    // stderr carries plugin loading warnings only, keep it out of the parsed stream
+    m_process->setStandardErrorFile(QProcess::nullDevice());
+    m_process->start("gst-inspect-1.0", QStringList() << "--print-all");
+#endif
+    return true;
+}
+
+bool GstStudio::GstInspectParser::loadOutput(QByteArrayView output) {
+    if (isParsing()) {
         return false;
     }
 
+    m_expectedCount = 0;
+    resetCatalog();
+    m_catalog.close();
+    resetStreamState();
+
+    parseElementList(output);
+    emit catalogReset();
     return true;
 }
 
+QList<GstElement> GstStudio::GstInspectParser::parseOutput(QByteArrayView output) {
+    const auto parse = [](const GstInspectSection& section) {
+        GstElement element = parseElementDetails(section.m_text);
+        element.m_name = section.m_elementName;
+        return element;
+    };
+    return QtConcurrent::blockingMapped<QList<GstElement>>(GstInspectSectionSplitter::split(output), parse);
+}
+
+void GstStudio::GstInspectParser::cancelParsing() {
+    if (!isParsing()) {
+        return;
+    }
+
+    if (m_incrementalRefresh || m_pluginScan) {
+        m_jobQueue->cancel();
+        m_pendingPluginFiles.clear();
+        m_scheduledElements.clear();
+        m_incrementalRefresh = false;
+        m_pluginScan = false;
+        discardPendingBatches();
+        resetStreamState();
+        emit parsingFailed(tr("Element discovery cancelled"));
+        return;
+    }
+
+    m_cancelled = true;
+    if (m_process->state() != QProcess::NotRunning) {
+        // onProcessFinished() reports the cancellation
+        m_process->kill();
+        return;
+    }
+
+    discardPendingBatches();
+    resetStreamState();
+    emit parsingFailed(tr("Element discovery cancelled"));
+}
+
+bool GstStudio::GstInspectParser::isParsing() const {
+    return m_process->state() != QProcess::NotRunning || !m_pendingBatches.isEmpty() || m_outputComplete ||
+           m_incrementalRefresh || m_pluginScan;
+}
+
+void GstStudio::GstInspectParser::setCacheFilePath(const QString& path) {
+    m_cacheFilePath = path;
+}
+
+QString GstStudio::GstInspectParser::cacheFilePath() const {
+    return m_cacheFilePath;
+}
+
+void GstStudio::GstInspectParser::setWorkerCount(int count) {
+    m_threadPool->setMaxThreadCount(count < 1 ? QThread::idealThreadCount() : count);
+}
+
+int GstStudio::GstInspectParser::workerCount() const {
+    return m_threadPool->maxThreadCount();
+}
+
+void GstStudio::GstInspectParser::setDiscoveryMode(DiscoveryMode mode) {
+    m_discoveryMode = mode;
+}
+
+GstInspectParser::DiscoveryMode GstStudio::GstInspectParser::discoveryMode() const {
+    return m_discoveryMode;
+}
+
+void GstStudio::GstInspectParser::setInspectTimeout(int msecs) {
+    m_jobQueue->setTimeout(msecs);
+}
+
+int GstStudio::GstInspectParser::inspectTimeout() const {
+    return m_jobQueue->timeout();
+}
+
 GstElement GstStudio::GstInspectParser::parseElement(const QString& elementName) {
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+    return GstRegistryBackend::element(elementName);
+#else
     QProcess process;
+    process.setProcessEnvironment(GstInspectJobQueue::inspectEnvironment());
     process.start("gst-inspect-1.0", QStringList() << elementName);
     process.waitForFinished();
-
-    QString output = process.readAllStandardOutput();
-    return parseElementDetails(output);
+    return parseElementOutput(elementName, process.readAllStandardOutput());
+#endif
 }
 
 void GstInspectParser::onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus) {
-    if (exitCode == 0) {
-        QString output = m_process->readAllStandardOutput();
-        parseElementList(output);
+    if (m_cancelled) {
+        discardPendingBatches();
+        resetStreamState();
+        emit parsingFailed(tr("Element discovery cancelled"));
+        return;
+    }
+
+    processSections(m_splitter.finish());
+
+    if (exitStatus != QProcess::NormalExit) {
+        m_failureMessage = tr("gst-inspect-1.0 crashed after %1 elements").arg(m_dispatchedCount);
+    } else if (exitCode != 0 && m_dispatchedCount == 0) {
+        m_failureMessage = tr("gst-inspect-1.0 exited with code %1").arg(exitCode);
+    }
+
+    m_outputComplete = true;
+    completeIfIdle();
+}
+
+void GstInspectParser::onReadyReadStandardOutput() {
+    processSections(m_splitter.feed(m_process->readAllStandardOutput()));
+}
+
+void GstInspectParser::onProcessErrorOccurred(QProcess::ProcessError error) {
+    // Crashes and kills are reported through finished(); only a failed start never reaches it
+    if (error == QProcess::FailedToStart) {
+        resetStreamState();
+        emit parsingFailed(tr("Unable to start gst-inspect-1.0: %1").arg(m_process->errorString()));
+    }
+}
+
+void GstInspectParser::onBatchFinished() {
+    // Batches may finish out of order; merge strictly from the front to keep output order
+    while (!m_pendingBatches.isEmpty() && m_pendingBatches.first()->isFinished()) {
+        QFutureWatcher<GstElement>* watcher = m_pendingBatches.takeFirst();
+        mergeElements(watcher->future().results());
+        watcher->deleteLater();
+    }
+
+    completeIfIdle();
+}
+
+void GstStudio::GstInspectParser::processSections(const QList<GstInspectSection>& sections) {
+    if (sections.isEmpty()) {
+        return;
+    }
+
+    deferDetails(sections);
+    dispatchBatch(
+        QtConcurrent::mapped(m_threadPool, sections, interning(m_stringPool, &GstInspectParser::parseSection)),
+        static_cast<int>(sections.size()));
+}
+
+void GstStudio::GstInspectParser::dispatchBatch(const QFuture<GstElement>& future, int count) {
+    auto* watcher = new QFutureWatcher<GstElement>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, &GstInspectParser::onBatchFinished);
+    m_pendingBatches.append(watcher);
+    m_dispatchedCount += count;
+    watcher->setFuture(future);
+}
+
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+void GstStudio::GstInspectParser::startRegistryScan() {
+    // Batches of this size keep progress reporting responsive without flooding the event loop
+    constexpr qsizetype kBatchSize = 64;
+
+    QString errorMessage;
+    const QStringList names = GstRegistryBackend::elementNames(&errorMessage);
+    if (!errorMessage.isEmpty()) {
+        emit parsingFailed(tr("Unable to initialize GStreamer: %1").arg(errorMessage));
+        return;
+    }
+
+    m_expectedCount = static_cast<int>(names.size());
+    for (qsizetype i = 0; i < names.size(); i += kBatchSize) {
+        const QStringList batch = names.mid(i, kBatchSize);
+        dispatchBatch(QtConcurrent::mapped(m_threadPool, batch, interning(m_stringPool, &GstRegistryBackend::element)),
+                      static_cast<int>(batch.size()));
+    }
+
+    // The whole registry has been dispatched; completeIfIdle() finishes once the last batch is merged
+    m_outputComplete = true;
+    completeIfIdle();
+}
+#endif
+
+void GstStudio::GstInspectParser::mergeElements(const QList<GstElement>& elements) {
+    for (const GstElement& element : elements) {
+        m_elements[element.m_name] = element;
+        ++m_parsedCount;
+
+        emit elementParsed(element.m_name);
+    }
+
+    if (!elements.isEmpty()) {
+        emit parsingProgress(m_parsedCount, m_expectedCount);
+    }
+}
+
+void GstStudio::GstInspectParser::completeIfIdle() {
+    if (!m_outputComplete || !m_pendingBatches.isEmpty()) {
+        return;
+    }
+
+    const QString failureMessage = m_failureMessage;
+    resetStreamState();
+
+    if (failureMessage.isEmpty()) {
+        saveCache();
         emit parsingFinished();
+    } else {
+        emit parsingFailed(failureMessage);
+    }
+}
+
+void GstStudio::GstInspectParser::discardPendingBatches() {
+    for (QFutureWatcher<GstElement>* watcher : std::as_const(m_pendingBatches)) {
+        watcher->disconnect(this);
+        watcher->cancel();
+        watcher->deleteLater();
+    }
+    m_pendingBatches.clear();
+}
+
+bool GstStudio::GstInspectParser::openCache() {
+    if (m_cacheFilePath.isEmpty() || !m_catalog.open(m_cacheFilePath)) {
+        return false;
+    }
+
+    resetCatalog();
+    emit catalogReset();
+    return true;
+}
+
+bool GstStudio::GstInspectParser::startIncrementalRefresh() {
+    GstPluginSnapshot stored;
+    if (!GstRegistryCache::loadSnapshot(GstRegistryCache::snapshotFilePath(m_cacheFilePath), stored) ||
+        stored.isEmpty()) {
+        return false;
+    }
+
+    const GstPluginSnapshot current = GstRegistryCache::snapshotPluginFiles();
+    QStringList changedFiles;
+    for (auto it = current.constBegin(); it != current.constEnd(); ++it) {
+        if (stored.value(it.key()) != it.value()) {
+            changedFiles.append(it.key());
+        }
+    }
+
+    // Re-inspecting plugin by plugin only pays off while few plugins changed
+    if (changedFiles.size() * 4 > current.size()) {
+        return false;
+    }
+
+    materializeCatalog();
+    resetStreamState();
+    m_incrementalRefresh = true;
+
+    for (auto it = stored.constBegin(); it != stored.constEnd(); ++it) {
+        if (!current.contains(it.key())) {
+            removePluginElements(it.key(), {});
+        }
+    }
+
+    if (changedFiles.isEmpty()) {
+        // Only the registry or removed plugins differ; the patched catalog is complete
+        onJobQueueFinished();
+        return true;
+    }
+
+    // Changed plugin files make the registry stale; let one process rebuild it before the others start
+    m_jobQueue->enqueueExclusive({});
+    for (const QString& file : std::as_const(changedFiles)) {
+        m_pendingPluginFiles.insert(file);
+        m_jobQueue->enqueue({file});
     }
+    return true;
 }
 
-void GstStudio::GstInspectParser::parseElementList(const QString& output) {
-    // For --print-all, we need to look for element sections
-    // Each element starts with "elementname: Factory Details:"
-    static QRegularExpression elementStartRegex(R"(^(\w+):\s+Factory Details:)");
-    QStringList lines = output.split('\n');
+void GstStudio::GstInspectParser::startPluginScan() {
+    const GstPluginSnapshot plugins = GstRegistryCache::snapshotPluginFiles();
+    if (plugins.isEmpty()) {
+        emit parsingFailed(tr("No GStreamer plugin files found"));
+        return;
+    }
+
+    // gst-inspect-1.0 prints element details one element at a time; a plugin file only yields the
+    // names of its features, which onJobFinished() queues behind the remaining plugin files
+    m_pluginScan = true;
+
+    // After a GStreamer update every process of the first wave would rebuild the registry on its own, in
+    // parallel, and likely exceed the timeout; one run without the timeout rebuilds it for all of them
+    m_jobQueue->enqueueExclusive({});
+    for (auto it = plugins.constBegin(); it != plugins.constEnd(); ++it) {
+        m_pendingPluginFiles.insert(it.key());
+        m_jobQueue->enqueue({it.key()});
+    }
+}
 
-    for (int i = 0; i < lines.size(); ++i) {
-        QRegularExpressionMatch match = elementStartRegex.match(lines[i]);
-        if (match.hasMatch()) {
-            QString elementName = match.captured(1);
+void GstStudio::GstInspectParser::materializeCatalog() {
+    resetCatalog();
+    for (int i = 0; i < m_catalog.elementCount(); ++i) {
+        GstElement element = m_catalog.element(i);
+        m_stringPool->internElement(element);
+        m_elements.insert(element.m_name, element);
+    }
+    m_catalog.close();
+}
 
-            // Find the end of this element's section (next element or end of file)
-            int endIndex = static_cast<int>(lines.size());
-            for (int j = i + 1; j < lines.size(); ++j) {
-                if (elementStartRegex.match(lines[j]).hasMatch()) {
-                    endIndex = j;
-                    break;
+void GstStudio::GstInspectParser::removePluginElements(const QString& pluginFile, const QStringList& keep) {
+    // Plugin directories may be reached through symlinks, so match on the library file name
+    const QString fileName = QFileInfo(pluginFile).fileName();
+    for (auto it = m_elements.begin(); it != m_elements.end();) {
+        if (QFileInfo(it.value().m_pluginFilename).fileName() == fileName && !keep.contains(it.key())) {
+            const QString elementName = it.key();
+            it = m_elements.erase(it);
+            m_detailSections.remove(elementName);
+            emit elementRemoved(elementName);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void GstInspectParser::onJobFinished(const QStringList& arguments, const QByteArray& output, bool success) {
+    if ((!m_incrementalRefresh && !m_pluginScan) || arguments.isEmpty()) {
+        return;
+    }
+
+    const QString& argument = arguments.first();
+    if (m_pendingPluginFiles.remove(argument)) {
+        // A plugin that no longer loads or timed out provides no elements
+        const QStringList features = success ? parsePluginFeatures(QString::fromUtf8(output)) : QStringList();
+        if (m_incrementalRefresh) {
+            removePluginElements(argument, features);
+        }
+        for (const QString& elementName : features) {
+            // The same plugin may be installed in several plugin directories
+            if (m_pluginScan) {
+                if (m_scheduledElements.contains(elementName)) {
+                    continue;
                 }
+                m_scheduledElements.insert(elementName);
             }
+            m_jobQueue->enqueue({elementName});
+        }
+        return;
+    }
 
-            // Extract this element's section
-            QStringList elementLines = lines.mid(i, endIndex - i);
-            QString elementOutput = elementLines.join('\n');
+    if (!success) {
+        return;
+    }
 
-            // Parse the element details
-            GstElement element = parseElementDetails(elementOutput);
-            element.m_name = elementName;
+    if (m_pluginScan) {
+        // Elements are parsed on the workers as their process completes; the GUI thread only merges them
+        dispatchBatch(QtConcurrent::run(m_threadPool,
+                                        [pool = m_stringPool, argument, output]() {
+                                            GstElement element = parseElementOutput(argument, output);
+                                            pool->internElement(element);
+                                            return element;
+                                        }),
+                      1);
+        return;
+    }
 
-            m_elements[elementName] = element;
-            emit elementParsed(elementName);
+    GstElement element = parseElementOutput(argument, output);
+    m_stringPool->internElement(element);
+    const bool exists = m_elements.contains(argument);
+    m_elements.insert(argument, element);
+    m_detailSections.remove(argument);
+    ++m_parsedCount;
+
+    if (exists) {
+        emit elementUpdated(argument);
+    } else {
+        emit elementAdded(argument);
+    }
+    emit parsingProgress(m_parsedCount, 0);
+}
 
-            // Skip to the next element
-            i = endIndex - 1;
+void GstInspectParser::onJobQueueFinished() {
+    if (m_pluginScan) {
+        m_pluginScan = false;
+        m_pendingPluginFiles.clear();
+        m_scheduledElements.clear();
+        if (m_dispatchedCount == 0) {
+            m_failureMessage = tr("gst-inspect-1.0 reported no elements");
         }
+
+        // completeIfIdle() finishes once the last element is parsed and merged
+        m_outputComplete = true;
+        completeIfIdle();
+        return;
     }
-}
 
-GstElement GstStudio::GstInspectParser::parseElementDetails(const QString& output) {
-    GstElement element;
+    if (!m_incrementalRefresh) {
+        return;
+    }
+
+    m_incrementalRefresh = false;
+    m_pendingPluginFiles.clear();
+    m_parsedCount = 0;
+    saveCache();
+    emit parsingFinished();
+}
 
-    // Parse factory details - looking for lines like "dv1394src:   Long-name                Firewire (1394) DV video
-    // source"
-    static QRegularExpression longNameRegex(R"(\w+:\s+Long-name\s+(.+))");
-    QRegularExpressionMatch longNameMatch = longNameRegex.match(output);
-    if (longNameMatch.hasMatch()) {
-        element.m_longName = longNameMatch.captured(1).trimmed();
+void GstStudio::GstInspectParser::saveCache() {
+    if (m_cacheFilePath.isEmpty() || m_elements.isEmpty()) {
+        return;
     }
 
-    static QRegularExpression klassRegex(R"(\w+:\s+Klass\s+(.+))");
-    QRegularExpressionMatch klassMatch = klassRegex.match(output);
-    if (klassMatch.hasMatch()) {
-        element.m_classification = klassMatch.captured(1).trimmed();
+    // The fingerprint is taken after the scan, since gst-inspect may have just rewritten the registry.
+    // Details nobody has looked at yet are parsed here so the cache is always complete.
+    m_threadPool->start([path = m_cacheFilePath, elements = m_elements, details = m_detailSections]() mutable {
+        completeDetails(elements, details);
+        const GstPluginSnapshot snapshot = GstRegistryCache::snapshotPluginFiles();
+        if (GstMappedCatalog::write(path, GstRegistryCache::fingerprint(snapshot), elements)) {
+            GstRegistryCache::saveSnapshot(GstRegistryCache::snapshotFilePath(path), snapshot);
+        }
+    });
+}
+
+void GstStudio::GstInspectParser::completeDetails(QMap<QString, GstElement>& elements,
+                                                  const QHash<QString, QString>& details) {
+    for (auto it = details.constBegin(); it != details.constEnd(); ++it) {
+        auto element = elements.find(it.key());
+        if (element != elements.end()) {
+            parseElementBody(it.value(), *element);
+        }
     }
+}
 
-    static QRegularExpression descRegex(R"(\w+:\s+Description\s+(.+))");
-    QRegularExpressionMatch descMatch = descRegex.match(output);
-    if (descMatch.hasMatch()) {
-        element.m_description = descMatch.captured(1).trimmed();
+QStringList GstStudio::GstInspectParser::parsePluginFeatures(const QString& output) {
+    // Features are listed as "  capsfilter: CapsFilter"; typefinders ("video/x-ms-asf: asf"),
+    // tracers and device providers ("latency (GstTracerFactory)") do not match
+    static QRegularExpression featureRegex(R"(^\s+([\w-]+): \S)", QRegularExpression::MultilineOption);
+    QStringList features;
+    QRegularExpressionMatchIterator it = featureRegex.globalMatch(output);
+    while (it.hasNext()) {
+        features.append(it.next().captured(1));
     }
+    return features;
+}
+
+GstElement GstStudio::GstInspectParser::parseElementOutput(const QString& elementName, const QByteArray& output) {
+    GstElement element = parseElementDetails(prefixElementOutput(elementName, QString::fromUtf8(output)));
+    element.m_name = elementName;
+    return element;
+}
 
-    static QRegularExpression authorRegex(R"(\w+:\s+Author\s+(.+))");
-    QRegularExpressionMatch authorMatch = authorRegex.match(output);
-    if (authorMatch.hasMatch()) {
-        element.m_author = authorMatch.captured(1).trimmed();
+QString GstStudio::GstInspectParser::prefixElementOutput(const QString& elementName, const QString& output) {
+    const QString prefix = elementName + ": ";
+    QString prefixed;
+    prefixed.reserve(output.size() + (output.count('\n') + 1) * prefix.size());
+    for (QStringView line : qTokenize(output, u'\n')) {
+        prefixed += prefix;
+        prefixed += line;
+        prefixed += '\n';
     }
+    return prefixed;
+}
 
-    // Parse rank
-    static QRegularExpression rankRegex(R"(\w+:\s+Rank\s+(\w+)\s+\((\d+)\))");
-    QRegularExpressionMatch rankMatch = rankRegex.match(output);
-    if (rankMatch.hasMatch()) {
-        element.m_rank = rankMatch.captured(1);
+GstElement GstStudio::GstInspectParser::parseSection(const GstInspectSection& section) {
+    GstElement element = parseElementHeader(section.m_text);
+    element.m_name = section.m_elementName;
+    return element;
+}
+
+GstElement GstStudio::GstInspectParser::parseSectionDetails(const GstInspectSection& section) {
+    GstElement element;
+    element.m_name = section.m_elementName;
+    parseElementBody(section.m_text, element);
+    return element;
+}
+
+void GstStudio::GstInspectParser::deferDetails(const QList<GstInspectSection>& sections) {
+    for (const GstInspectSection& section : sections) {
+        m_detailSections.insert(section.m_elementName, section.m_text);
     }
+}
+
+void GstStudio::GstInspectParser::resetCatalog() {
+    m_elements.clear();
+    resetDetails();
 
-    // Extract and parse properties section
-    QString propertiesSection = extractSection(output, "Element Properties:");
-    if (!propertiesSection.isEmpty()) {
-        parseProperties(propertiesSection, element);
+    // Workers still parsing for the old catalog keep its pool alive until they are done
+    m_stringPool = std::make_shared<GstStringPool>();
+}
+
+void GstStudio::GstInspectParser::resetDetails() {
+    m_detailSections.clear();
+    m_prefetching.clear();
+    ++m_detailGeneration;
+}
+
+void GstStudio::GstInspectParser::loadDetails(const QString& name) {
+    const auto section = m_detailSections.constFind(name);
+    if (section == m_detailSections.constEnd()) {
+        return;
     }
 
-    // Extract and parse pad templates section
-    QString padSection = extractSection(output, "Pad Templates:");
-    if (!padSection.isEmpty()) {
-        parsePadTemplates(padSection, element);
+    // The header of the element may still be in flight on the thread pool
+    auto element = m_elements.find(name);
+    if (element == m_elements.end()) {
+        return;
     }
 
+    parseElementBody(section.value(), *element);
+    m_stringPool->internElement(*element);
+    m_detailSections.erase(section);
+}
+
+void GstStudio::GstInspectParser::resetStreamState() {
+    m_splitter.reset();
+    m_failureMessage.clear();
+    m_parsedCount = 0;
+    m_dispatchedCount = 0;
+    m_cancelled = false;
+    m_outputComplete = false;
+}
+
+void GstStudio::GstInspectParser::parseElementList(QByteArrayView output) {
+    // Each element section starts with "elementname: Factory Details:"
+    const QList<GstInspectSection> sections = GstInspectSectionSplitter::split(output);
+    deferDetails(sections);
+    mergeElements(QtConcurrent::blockingMapped<QList<GstElement>>(
+        m_threadPool, sections, interning(m_stringPool, &GstInspectParser::parseSection)));
+}
+
+GstElement GstStudio::GstInspectParser::parseElementDetails(const QString& output) {
+    const GstInspectSectionIndex sections(output);
+    GstElement element;
+    parseElementHeader(sections, element);
+    parseElementBody(sections, element);
     return element;
 }
 
-void GstStudio::GstInspectParser::parseProperties(const QString& section, GstElement& element) {
+GstElement GstStudio::GstInspectParser::parseElementHeader(const QString& output) {
+    GstElement element;
+    parseElementHeader(GstInspectSectionIndex(output), element);
+    return element;
+}
+
+void GstStudio::GstInspectParser::parseElementBody(const QString& output, GstElement& element) {
+    parseElementBody(GstInspectSectionIndex(output), element);
+}
+
+void GstStudio::GstInspectParser::parseElementHeader(const GstInspectSectionIndex& sections, GstElement& element) {
+    using Section = GstInspectSectionIndex::Section;
+
+    // Factory details look like "dv1394src:   Long-name                Firewire (1394) DV video source". Every
+    // field keeps its first occurrence, so the factory description wins over the plugin description below it
+    bool rankFound = false;
+    for (Section section : {Section::FactoryDetails, Section::PluginDetails}) {
+        for (QStringView line : qTokenize(sections.section(section), u'\n')) {
+            QStringView key;
+            QStringView value;
+            if (!splitHeaderField(GstInspectSectionIndex::stripElementPrefix(line).trimmed(), key, value)) {
+                continue;
+            }
+
+            QString* field = nullptr;
+            if (key == u"Long-name") {
+                field = &element.m_longName;
+            } else if (key == u"Klass") {
+                field = &element.m_classification;
+            } else if (key == u"Description") {
+                field = &element.m_description;
+            } else if (key == u"Author") {
+                field = &element.m_author;
+            } else if (key == u"Name") {
+                // Plugin details, used to map elements back to the plugin file that provides them
+                field = &element.m_pluginName;
+            } else if (key == u"Filename") {
+                field = &element.m_pluginFilename;
+            } else if (key == u"Version") {
+                field = &element.m_pluginVersion;
+            } else if (key == u"License") {
+                field = &element.m_pluginLicense;
+            } else if (key == u"Rank" && !rankFound) {
+                rankFound = parseRank(value, element.m_rank);
+            }
+
+            if (field && field->isEmpty()) {
+                *field = value.toString();
+            }
+        }
+    }
+
+    element.m_signals = parseSignals(sections.section(Section::ElementSignals), GstSignal::Kind::Signal);
+    element.m_signals += parseSignals(sections.section(Section::ElementActions), GstSignal::Kind::Action);
+}
+
+void GstStudio::GstInspectParser::parseElementBody(const GstInspectSectionIndex& sections, GstElement& element) {
+    using Section = GstInspectSectionIndex::Section;
+
+    parsePadTemplates(sections.section(Section::PadTemplates), element);
+    parseUriHandling(sections.section(Section::UriHandling), element);
+    parseProperties(sections.section(Section::ElementProperties), element);
+}
+
+void GstStudio::GstInspectParser::parseProperties(QStringView section, GstElement& element) {
 
     // Properties are formatted like:
     // dv1394src:   automatic-eos       : Automatically EOS when the segment is done
-    // dv1394src:                         flags: lesbar, schreibbar
+    // dv1394src:                         flags: readable, writable
     // dv1394src:                         Boolean. Default: true
+    // gst-inspect-1.0 runs in the C locale; recordings made under a German locale say "lesbar, schreibbar"
+    // Enum and flags types list their values below the type line:
+    // videotestsrc:                         Enum "GstVideoTestSrcPattern" Default: 0, "smpte"
+    // videotestsrc:                            (0): smpte            - SMPTE 100% color bars
 
-    QStringList lines = section.split('\n');
     GstProperty currentProperty;
 
-    for (const QString& line : std::as_const(lines)) {
-        QString trimmedLine = line.trimmed();
+    for (QStringView line : qTokenize(section, u'\n')) {
+        // Lines are classified by their column after the element name prefix of --print-all output
+        const QStringView content = GstInspectSectionIndex::stripElementPrefix(line);
+        const QStringView trimmedLine = content.trimmed();
         if (trimmedLine.isEmpty()) {
             // Empty line might indicate end of current property
             if (!currentProperty.m_name.isEmpty()) {
@@ -148,11 +845,9 @@ void GstStudio::GstInspectParser::parseProperties(const QString& section, GstEle
             continue;
         }
 
-        // Check if this is a new property line (has property name and description)
-        static QRegularExpression propertyStartRegex(R"(\w+:\s+(\w+(?:-\w+)*)\s*:\s*(.+))");
-        QRegularExpressionMatch propMatch = propertyStartRegex.match(line);
-
-        if (propMatch.hasMatch()) {
+        QStringView name;
+        QStringView description;
+        if (indentation(content) < kPropertyDetailIndent && parsePropertyStart(trimmedLine, name, description)) {
             // Save previous property if exists
             if (!currentProperty.m_name.isEmpty()) {
                 element.m_properties.append(currentProperty);
@@ -160,41 +855,10 @@ void GstStudio::GstInspectParser::parseProperties(const QString& section, GstEle
 
             // Start new property
             currentProperty = GstProperty();
-            currentProperty.m_name = propMatch.captured(1);
-            currentProperty.m_description = propMatch.captured(2);
+            currentProperty.m_name = name.toString();
+            currentProperty.m_description = description.toString();
         } else if (!currentProperty.m_name.isEmpty()) {
-            // This is a continuation line for the current property
-
-            // Parse flags line
-            if (trimmedLine.contains("flags:")) {
-                currentProperty.m_readable = trimmedLine.contains("lesbar") || trimmedLine.contains("readable");
-                currentProperty.m_writable = trimmedLine.contains("schreibbar") || trimmedLine.contains("writable");
-                currentProperty.m_controllable = trimmedLine.contains("controllable");
-            }
-
-            // Parse type and default value
-            static QRegularExpression typeRegex(
-                R"(^(\w+(?:\s+\w+)*)\.\s*(?:Range:\s*([^D]+?))?\s*(?:Default:\s*(.+))?$)");
-            QRegularExpressionMatch typeMatch = typeRegex.match(trimmedLine);
-            if (typeMatch.hasMatch()) {
-                currentProperty.m_type = typeMatch.captured(1);
-                if (!typeMatch.captured(2).isEmpty()) {
-                    currentProperty.m_range = typeMatch.captured(2).trimmed();
-                }
-                if (!typeMatch.captured(3).isEmpty()) {
-                    currentProperty.m_defaultValue = typeMatch.captured(3).trimmed();
-                }
-            }
-
-            // Parse enum values (if this line contains enum information)
-            if (trimmedLine.contains("Enum") && trimmedLine.contains("Default:")) {
-                static QRegularExpression enumRegex(R"(\((\d+)\):\s*(\w+))");
-                QRegularExpressionMatchIterator enumIterator = enumRegex.globalMatch(trimmedLine);
-                while (enumIterator.hasNext()) {
-                    QRegularExpressionMatch enumMatch = enumIterator.next();
-                    currentProperty.m_enumValues.append(enumMatch.captured(2));
-                }
-            }
+            parsePropertyDetail(trimmedLine, currentProperty);
         }
     }
 
@@ -204,64 +868,196 @@ void GstStudio::GstInspectParser::parseProperties(const QString& section, GstEle
     }
 }
 
-GstProperty GstStudio::GstInspectParser::parseProperty(const QString& propertyText) {
-    GstProperty prop;
-    QStringList lines = propertyText.split('\n');
+bool GstStudio::GstInspectParser::parsePropertyStart(QStringView line, QStringView& name, QStringView& description) {
+    // Names are words joined by single dashes, followed by optional padding and a colon
+    qsizetype nameEnd = 0;
+    while (nameEnd < line.size() && (isWordChar(line.at(nameEnd)) || line.at(nameEnd) == u'-')) {
+        ++nameEnd;
+    }
+    name = line.first(nameEnd);
+    if (name.isEmpty() || name.startsWith(u'-') || name.endsWith(u'-') || name.contains(u"--")) {
+        return false;
+    }
 
-    if (lines.isEmpty())
-        return prop;
+    const QStringView rest = line.sliced(nameEnd).trimmed();
+    if (!rest.startsWith(u':')) {
+        return false;
+    }
+    description = rest.sliced(1).trimmed();
 
-    // First line contains name and description
-    const QString& firstLine = lines.first();
-    static QRegularExpression nameRegex(R"(^\s*(\w+)\s*:\s*(.+)$)");
-    QRegularExpressionMatch nameMatch = nameRegex.match(firstLine);
+    // The flags line has the same shape
+    return !description.isEmpty() && name.compare(u"flags", Qt::CaseInsensitive) != 0;
+}
 
-    if (nameMatch.hasMatch()) {
-        prop.m_name = nameMatch.captured(1);
-        prop.m_description = nameMatch.captured(2);
+void GstStudio::GstInspectParser::parsePropertyDetail(QStringView line, GstProperty& property) {
+    if (line.startsWith(u"flags:", Qt::CaseInsensitive)) {
+        property.m_flags = parsePropertyFlags(line.sliced(6));
+        return;
     }
 
-    // Parse remaining lines for flags, type, default value, etc.
-    for (int i = 1; i < lines.size(); ++i) {
-        QString line = lines[i].trimmed();
+    // Enum values: (0): smpte - SMPTE 100% color bars, or (0x00000001): deblock - Deblock for flags
+    if (line.startsWith(u'(')) {
+        const qsizetype close = line.indexOf(u"):");
+        QStringView number = close < 0 ? QStringView() : line.sliced(1, close - 1);
+        if (number.startsWith(u'-')) {
+            number = number.sliced(1);
+        }
+        const QStringView value = close < 0 ? QStringView() : line.sliced(close + 2).trimmed();
+        if (number.isEmpty() || !std::all_of(number.begin(), number.end(), isWordChar) || value.isEmpty()) {
+            matchPropertyDetail(line, property);
+            return;
+        }
+        const auto valueEnd = std::find_if(value.begin(), value.end(), [](QChar c) { return c.isSpace(); });
+        property.m_enumValues.append(QStringView(value.begin(), valueEnd).toString());
+        return;
+    }
 
-        // Parse flags
-        if (line.startsWith("flags:")) {
-            prop.m_readable = line.contains("readable");
-            prop.m_writable = line.contains("writable");
-            prop.m_controllable = line.contains("controllable");
+    // Enum and flags types name their GType: Enum "GstVideoTestSrcPattern" Default: 0, "smpte"
+    const qsizetype keywordEnd = line.startsWith(u"Enum") ? 4 : line.startsWith(u"Flags") ? 5 : 0;
+    const qsizetype open = keywordEnd > 0 ? line.indexOf(u'"', keywordEnd) : -1;
+    if (open > keywordEnd &&
+        std::all_of(line.begin() + keywordEnd, line.begin() + open, [](QChar c) { return isBlank(c); })) {
+        const qsizetype close = line.indexOf(u'"', open + 1);
+        const QStringView rest = close < 0 ? QStringView() : line.sliced(close + 1).trimmed();
+        const QStringView defaultValue = rest.startsWith(u"Default:") ? rest.sliced(8).trimmed() : QStringView();
+        if (close < 0 || (!rest.isEmpty() && defaultValue.isEmpty())) {
+            matchPropertyDetail(line, property);
+            return;
         }
+        property.m_type = line.first(close + 1).toString();
+        property.m_defaultValue = defaultValue.toString();
+        return;
+    }
 
-        // Parse type and default value
-        static QRegularExpression typeRegex(R"(^(\w+)\.\s*(?:Range:\s*([^D]+))?\s*(?:Default:\s*(.+))?$)");
-        QRegularExpressionMatch typeMatch = typeRegex.match(line);
-        if (typeMatch.hasMatch()) {
-            prop.m_type = typeMatch.captured(1);
-            prop.m_range = typeMatch.captured(2).trimmed();
-            prop.m_defaultValue = typeMatch.captured(3).trimmed();
+    // Type lines: Integer. Range: -1 - 2147483647 Default: -1
+    const qsizetype dot = line.indexOf(u'.');
+    if (dot <= 0 || !isWordChar(line.at(dot - 1)) ||
+        !std::all_of(line.begin(), line.begin() + dot, [](QChar c) { return isWordChar(c) || isBlank(c); })) {
+        // Nothing else is parsed, e.g. "Boxed pointer of type "GstCaps""
+        return;
+    }
+
+    QStringView rest = line.sliced(dot + 1).trimmed();
+    QStringView range;
+    if (rest.startsWith(u"Range:")) {
+        const qsizetype defaultPos = rest.indexOf(u"Default:");
+        range = (defaultPos < 0 ? rest.sliced(6) : rest.sliced(6, defaultPos - 6)).trimmed();
+        rest = defaultPos < 0 ? QStringView() : rest.sliced(defaultPos);
+        if (range.isEmpty() || range.contains(u'D')) {
+            matchPropertyDetail(line, property);
+            return;
         }
+    }
 
-        // Parse enum values
-        if (line.contains("Enum ") && line.contains("Default:")) {
-            static QRegularExpression enumRegex(R"(\((\d+)\):\s*(\w+))");
-            QRegularExpressionMatchIterator enumIterator = enumRegex.globalMatch(line);
-            while (enumIterator.hasNext()) {
-                QRegularExpressionMatch enumMatch = enumIterator.next();
-                prop.m_enumValues.append(enumMatch.captured(2));
-            }
+    QStringView defaultValue;
+    if (!rest.isEmpty()) {
+        defaultValue = rest.startsWith(u"Default:") ? rest.sliced(8).trimmed() : QStringView();
+        if (defaultValue.isEmpty()) {
+            matchPropertyDetail(line, property);
+            return;
+        }
+    }
+
+    property.m_type = line.first(dot).toString();
+    if (!range.isEmpty()) {
+        property.m_range = range.toString();
+    }
+    if (!defaultValue.isEmpty()) {
+        property.m_defaultValue = defaultValue.toString();
+    }
+}
+
+void GstStudio::GstInspectParser::matchPropertyDetail(QStringView line, GstProperty& property) {
+    // Parse type and default value
+    static QRegularExpression typeRegex(R"(^(\w+(?:\s+\w+)*)\.\s*(?:Range:\s*([^D]+?))?\s*(?:Default:\s*(.+))?$)");
+    QRegularExpressionMatch typeMatch = typeRegex.matchView(line);
+    if (typeMatch.hasMatch()) {
+        property.m_type = typeMatch.captured(1);
+        if (!typeMatch.captured(2).isEmpty()) {
+            property.m_range = typeMatch.captured(2).trimmed();
+        }
+        if (!typeMatch.captured(3).isEmpty()) {
+            property.m_defaultValue = typeMatch.captured(3).trimmed();
+        }
+        return;
+    }
+
+    static QRegularExpression enumTypeRegex(R"(^((?:Enum|Flags)\s+"[^"]*")\s*(?:Default:\s*(.+))?$)");
+    QRegularExpressionMatch enumTypeMatch = enumTypeRegex.matchView(line);
+    if (enumTypeMatch.hasMatch()) {
+        property.m_type = enumTypeMatch.captured(1);
+        property.m_defaultValue = enumTypeMatch.captured(2).trimmed();
+        return;
+    }
+
+    static QRegularExpression enumRegex(R"(^\((-?\w+)\):\s*(\S+))");
+    QRegularExpressionMatch enumMatch = enumRegex.matchView(line);
+    if (enumMatch.hasMatch()) {
+        property.m_enumValues.append(enumMatch.captured(2));
+    }
+}
+
+void GstStudio::GstInspectParser::parseUriHandling(QStringView section, GstElement& element) {
+    // URI handling capabilities:
+    //   Element can act as source.
+    //   Supported URI protocols:
+    //     file
+    bool inProtocols = false;
+    for (QStringView line : qTokenize(section, u'\n')) {
+        const QStringView trimmedLine = GstInspectSectionIndex::stripElementPrefix(line).trimmed();
+        if (trimmedLine.isEmpty()) {
+            continue;
+        }
+
+        if (trimmedLine.startsWith(u"Element can act as source")) {
+            element.m_uriType = GstElement::UriType::Source;
+        } else if (trimmedLine.startsWith(u"Element can act as sink")) {
+            element.m_uriType = GstElement::UriType::Sink;
+        } else if (trimmedLine == u"Supported URI protocols:") {
+            inProtocols = true;
+        } else if (inProtocols) {
+            element.m_uriProtocols.append(trimmedLine.toString());
         }
     }
+}
+
+QList<GstSignal> GstStudio::GstInspectParser::parseSignals(QStringView section, GstSignal::Kind kind) {
+    // Every signal starts with its quoted name, the declaration continues on deeper indented lines:
+    //   "handoff" :  void user_function (GstElement* object,
+    //                                    GstBuffer* arg0,
+    //                                    GstPad* arg1,
+    //                                    gpointer user_data);
+    QList<GstSignal> descriptors;
+    QString declaration;
+    for (QStringView line : qTokenize(section, u'\n')) {
+        const QStringView trimmedLine = GstInspectSectionIndex::stripElementPrefix(line).trimmed();
+        if (trimmedLine.startsWith(u'"')) {
+            declaration = trimmedLine.toString();
+        } else if (!declaration.isEmpty() && !trimmedLine.isEmpty()) {
+            declaration += u' ';
+            declaration += trimmedLine;
+        } else {
+            continue;
+        }
 
-    return prop;
+        if (declaration.contains(u')')) {
+            GstSignal descriptor;
+            descriptor.m_kind = kind;
+            if (parseSignalDeclaration(declaration, descriptor)) {
+                descriptors.append(descriptor);
+            }
+            declaration.clear();
+        }
+    }
+    return descriptors;
 }
 
-void GstStudio::GstInspectParser::parsePadTemplates(const QString& section, GstElement& element) {
-    QStringList lines = section.split('\n');
+void GstStudio::GstInspectParser::parsePadTemplates(QStringView section, GstElement& element) {
     GstPadTemplate currentPad;
     bool inCapabilities = false;
 
-    for (const QString& line : std::as_const(lines)) {
-        QString trimmedLine = line.trimmed();
+    for (QStringView line : qTokenize(section, u'\n')) {
+        const QStringView trimmedLine = line.trimmed();
         if (trimmedLine.isEmpty())
             continue;
 
@@ -273,7 +1069,7 @@ void GstStudio::GstInspectParser::parsePadTemplates(const QString& section, GstE
             continue;
         }
 
-        if (processCapabilitiesSection(trimmedLine, currentPad, inCapabilities)) {
+        if (processCapabilitiesSection(line, currentPad, inCapabilities)) {
             continue;
         }
     }
@@ -281,81 +1077,103 @@ void GstStudio::GstInspectParser::parsePadTemplates(const QString& section, GstE
     finalizePadTemplate(currentPad, element);
 }
 
-GstPadTemplate GstStudio::GstInspectParser::parsePadTemplate(const QString& padText) {
-    GstPadTemplate pad;
-    QStringList lines = padText.split('\n');
-
-    for (const QString& line : std::as_const(lines)) {
-        QString trimmedLine = line.trimmed();
+bool GstStudio::GstInspectParser::processPadTemplateHeader(QStringView line, GstPadTemplate& currentPad,
+                                                           GstElement& element, bool& inCapabilities) {
+    // "SRC template: 'src_%u'"; anything else is not a header
+    const QStringView content = GstInspectSectionIndex::stripElementPrefix(line).trimmed();
+    const bool source = content.startsWith(u"SRC");
+    if (!source && !content.startsWith(u"SINK")) {
+        return false;
+    }
 
-        parsePadNameAndDirection(trimmedLine, pad);
-        processAvailabilityLine(trimmedLine, pad);
-        processCapabilityLine(trimmedLine, pad);
+    const QStringView afterDirection = content.sliced(source ? 3 : 4);
+    const QStringView rest = afterDirection.trimmed();
+    if (afterDirection.isEmpty() || !isBlank(afterDirection.front()) || !rest.startsWith(u"template:")) {
+        return false;
+    }
+    const QStringView quoted = rest.sliced(9).trimmed();
+    const qsizetype close = quoted.startsWith(u'\'') ? quoted.indexOf(u'\'', 1) : -1;
+    if (close <= 1) {
+        return false;
     }
 
-    return pad;
-}
+    finalizePadTemplate(currentPad, element);
 
-bool GstStudio::GstInspectParser::processPadTemplateHeader(const QString& line, GstPadTemplate& currentPad,
-                                                           GstElement& element, bool& inCapabilities) {
-    static QRegularExpression padRegex(R"(\w+:\s+(SRC|SINK)\s+template:\s*'([^']+)')");
-    QRegularExpressionMatch padMatch = padRegex.match(line);
-    if (padMatch.hasMatch()) {
-        finalizePadTemplate(currentPad, element);
-
-        currentPad = GstPadTemplate();
-        currentPad.m_direction = padMatch.captured(1);
-        currentPad.m_name = padMatch.captured(2);
-        inCapabilities = false;
-        return true;
-    }
-    return false;
+    currentPad = GstPadTemplate();
+    currentPad.m_direction = source ? GstPadTemplate::Direction::Src : GstPadTemplate::Direction::Sink;
+    currentPad.m_name = quoted.sliced(1, close - 1).toString();
+    inCapabilities = false;
+    return true;
 }
 
-bool GstStudio::GstInspectParser::processAvailabilityLine(const QString& trimmedLine, GstPadTemplate& pad) {
-    if (trimmedLine.contains("Availability:")) {
-        if (trimmedLine.contains("Always"))
-            pad.m_presence = "ALWAYS";
-        else if (trimmedLine.contains("Sometimes"))
-            pad.m_presence = "SOMETIMES";
-        else if (trimmedLine.contains("On request"))
-            pad.m_presence = "REQUEST";
+bool GstStudio::GstInspectParser::processAvailabilityLine(QStringView trimmedLine, GstPadTemplate& pad) {
+    if (trimmedLine.contains(u"Availability:")) {
+        if (trimmedLine.contains(u"Always"))
+            pad.m_presence = GstPadTemplate::Presence::Always;
+        else if (trimmedLine.contains(u"Sometimes"))
+            pad.m_presence = GstPadTemplate::Presence::Sometimes;
+        else if (trimmedLine.contains(u"On request"))
+            pad.m_presence = GstPadTemplate::Presence::Request;
         return true;
     }
     return false;
 }
 
-bool GstStudio::GstInspectParser::processCapabilitiesSection(const QString& trimmedLine, GstPadTemplate& currentPad,
+bool GstStudio::GstInspectParser::processCapabilitiesSection(QStringView line, GstPadTemplate& currentPad,
                                                              bool& inCapabilities) {
-    if (trimmedLine.contains("Capabilities:")) {
+    const QStringView content = GstInspectSectionIndex::stripElementPrefix(line);
+    const QStringView trimmedContent = content.trimmed();
+    if (trimmedContent == u"Capabilities:") {
         inCapabilities = true;
         return true;
     }
 
-    if (inCapabilities && isCapabilityLine(trimmedLine)) {
-        if (!currentPad.m_caps.isEmpty()) {
-            currentPad.m_caps += "\n";
-        }
-        currentPad.m_caps += trimmedLine;
-        return true;
+    if (!inCapabilities) {
+        return false;
     }
 
-    if (inCapabilities && isSectionEnd(trimmedLine)) {
+    if (isSectionEnd(line)) {
         inCapabilities = false;
         return true;
     }
 
+    if (isCapabilityLine(content)) {
+        appendCapsLine(currentPad.m_caps, trimmedContent);
+        return true;
+    }
+
     return false;
 }
 
-bool GstStudio::GstInspectParser::isCapabilityLine(const QString& line) {
-    return line.startsWith("video/") || line.startsWith("audio/") || line.startsWith("application/") ||
-           line.startsWith("text/") || line.startsWith("image/") || line.contains("format:") ||
-           line.contains("systemstream:");
+bool GstStudio::GstInspectParser::isCapabilityLine(QStringView content) {
+    // Caps are indented below "Capabilities:"; anything shallower ends the block
+    constexpr qsizetype kCapsIndent = 6;
+    qsizetype indent = 0;
+    while (indent < content.size() && content.at(indent).isSpace()) {
+        ++indent;
+    }
+    return indent >= kCapsIndent && indent < content.size();
+}
+
+void GstStudio::GstInspectParser::appendCapsLine(QString& caps, QStringView line) {
+    if (!caps.isEmpty()) {
+        // Long lists are wrapped over several lines; keep each field on one line
+        const QStringView lastLine = QStringView(caps).sliced(caps.lastIndexOf(u'\n') + 1);
+        qsizetype open = 0;
+        for (QChar c : lastLine) {
+            if (c == u'{' || c == u'[' || c == u'<') {
+                ++open;
+            } else if (c == u'}' || c == u']' || c == u'>') {
+                --open;
+            }
+        }
+        caps += open > 0 ? u' ' : u'\n';
+    }
+    caps += line;
 }
 
-bool GstStudio::GstInspectParser::isSectionEnd(const QString& line) {
-    return line.contains("Element has") || line.contains("URI handling") || line.contains("Pads:");
+bool GstStudio::GstInspectParser::isSectionEnd(QStringView line) {
+    return line.contains(u"Element has") || line.contains(u"URI handling") || line.contains(u"Pads:");
 }
 
 void GstStudio::GstInspectParser::finalizePadTemplate(GstPadTemplate& pad, GstElement& element) {
@@ -364,79 +1182,109 @@ void GstStudio::GstInspectParser::finalizePadTemplate(GstPadTemplate& pad, GstEl
     }
 }
 
-void GstStudio::GstInspectParser::parsePadNameAndDirection(const QString& line, GstPadTemplate& pad) {
-    static QRegularExpression padRegex(R"(^(SRC|SINK)\s+template:\s*'([^']+)')");
-    QRegularExpressionMatch padMatch = padRegex.match(line);
-    if (padMatch.hasMatch()) {
-        pad.m_direction = padMatch.captured(1);
-        pad.m_name = padMatch.captured(2);
+QStringList GstStudio::GstInspectParser::getAllElementNames() const {
+    if (m_elements.isEmpty() && m_catalog.isOpen()) {
+        return m_catalog.elementNames();
     }
+    return m_elements.keys();
 }
 
-void GstStudio::GstInspectParser::processCapabilityLine(const QString& line, GstPadTemplate& pad) {
-    if (line.startsWith("Capabilities:")) {
-        return;
+GstElement GstStudio::GstInspectParser::getElement(const QString& name) {
+    if (m_elements.isEmpty() && m_catalog.isOpen()) {
+        return m_catalog.element(m_catalog.indexOf(name));
     }
 
-    if (line.contains("/") && !line.startsWith("Availability:")) {
-        if (!pad.m_caps.isEmpty())
-            pad.m_caps += "\n";
-        pad.m_caps += line;
-    }
+    loadDetails(name);
+    return m_elements.value(name);
 }
 
-QString GstStudio::GstInspectParser::extracted() {
-    return {};
+GstElement GstStudio::GstInspectParser::getElementHeader(const QString& name) const {
+    if (m_elements.isEmpty() && m_catalog.isOpen()) {
+        return m_catalog.elementHeader(m_catalog.indexOf(name));
+    }
+    return m_elements.value(name);
 }
-QString GstStudio::GstInspectParser::extractSection(const QString& text, const QString& sectionName) {
-    auto startPos = text.indexOf(sectionName);
-    if (startPos == -1)
-        return extracted();
 
-    startPos += sectionName.length();
-
-    // Find the next major section or end of text
-    QStringList nextSections = {
-        "Factory Details:", "Pad Templates:", "Element Properties:", "Element Signals:", "Element Actions:"};
-    auto endPos = text.length();
-
-    for (const QString& nextSection : nextSections) {
-        if (nextSection == sectionName)
-            continue;
-        auto pos = text.indexOf(nextSection, startPos);
-        if (pos != -1 && pos < endPos) {
-            endPos = pos;
+void GstStudio::GstInspectParser::prefetchDetails(const QStringList& names) {
+    QList<GstInspectSection> sections;
+    for (const QString& name : names) {
+        const auto section = m_detailSections.constFind(name);
+        if (section != m_detailSections.constEnd() && !m_prefetching.contains(name)) {
+            sections.append({name, section.value()});
+            m_prefetching.insert(name);
         }
     }
+    if (sections.isEmpty()) {
+        return;
+    }
 
-    return text.mid(startPos, endPos - startPos);
-}
-
-QStringList GstStudio::GstInspectParser::splitIntoSections(const QString& text, const QString& delimiter) {
-    return text.split(delimiter, Qt::SkipEmptyParts);
-}
-
-QString GstStudio::GstInspectParser::cleanupText(const QString& text) {
-    static QRegularExpression replaceRegex("\\s+");
-    return text.trimmed().replace(replaceRegex, " ");
-}
-
-QStringList GstStudio::GstInspectParser::getAllElementNames() const {
-    return m_elements.keys();
-}
+    auto* watcher = new QFutureWatcher<GstElement>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, generation = m_detailGeneration]() {
+        watcher->deleteLater();
+        if (generation != m_detailGeneration) {
+            return;
+        }
 
-GstElement GstStudio::GstInspectParser::getElement(const QString& name) const {
-    return m_elements.value(name);
+        for (const GstElement& details : watcher->future().results()) {
+            m_prefetching.remove(details.m_name);
+            // Elements loaded on demand or replaced in the meantime no longer have a pending section
+            if (m_detailSections.remove(details.m_name)) {
+                auto element = m_elements.find(details.m_name);
+                if (element != m_elements.end()) {
+                    element->m_properties = details.m_properties;
+                    element->m_padTemplates = details.m_padTemplates;
+                    element->m_uriType = details.m_uriType;
+                    element->m_uriProtocols = details.m_uriProtocols;
+                }
+            }
+        }
+    });
+    watcher->setFuture(QtConcurrent::mapped(m_threadPool, sections,
+                                               interning(m_stringPool, &GstInspectParser::parseSectionDetails)));
 }
 
 QStringList GstStudio::GstInspectParser::getElementsByClassification(const QString& classification) const {
+    if (m_elements.isEmpty() && m_catalog.isOpen()) {
+        return m_catalog.elementsByClassification(classification);
+    }
+
+    // Classifications are interned, so a few hundred distinct strings are shared by all elements;
+    // test each one once and look the rest up by buffer address
+    QHash<const QChar*, bool> matches;
     QStringList result;
     for (auto it = m_elements.begin(); it != m_elements.end(); ++it) {
-        if (it.value().m_classification.contains(classification, Qt::CaseInsensitive)) {
+        const QString& klass = it.value().m_classification;
+        auto match = matches.constFind(klass.constData());
+        if (match == matches.constEnd()) {
+            match = matches.insert(klass.constData(), klass.contains(classification, Qt::CaseInsensitive));
+        }
+        if (match.value()) {
             result.append(it.key());
         }
     }
     return result;
 }
 
+std::function<QList<GstElement>()> GstStudio::GstInspectParser::elementLoader() const {
+    if (m_elements.isEmpty() && m_catalog.isOpen()) {
+        // The mapping belongs to this thread and may be closed by a refresh; map the file again
+        return [path = m_cacheFilePath]() {
+            QList<GstElement> elements;
+            GstMappedCatalog catalog;
+            if (catalog.open(path)) {
+                elements.reserve(catalog.elementCount());
+                for (int i = 0; i < catalog.elementCount(); ++i) {
+                    elements.append(catalog.element(i));
+                }
+            }
+            return elements;
+        };
+    }
+
+    return [elements = m_elements, details = m_detailSections]() mutable {
+        completeDetails(elements, details);
+        return elements.values();
+    };
+}
+
 } // namespace GstStudio
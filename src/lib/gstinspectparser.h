@@ -7,13 +7,26 @@
 #pragma once
 
 #include "gstelement.h"
+#include "gstinspectjobqueue.h"
+#include "gstinspectsplitter.h"
+#include "gstmappedcatalog.h"
+#include "gstregistrycache.h"
+#include "gststringpool.h"
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QHash>
 #include <QList>
 #include <QMap>
 #include <QObject>
 #include <QProcess>
 #include <QRegularExpression>
+#include <QSet>
 #include <QString>
 #include <QStringList>
+#include <QStringView>
+#include <QThreadPool>
+#include <functional>
+#include <memory>
 
 namespace GstStudio {
 
@@ -24,12 +37,23 @@ namespace GstStudio {
  * This class provides functionality to parse GStreamer element information
  * using the gst-inspect-1.0 command line tool. It can parse all available
  * elements or specific elements and extract their properties, pad templates,
- * and other metadata.
+ * and other metadata. When built with GSTSTUDIO_REGISTRY_BACKEND, elements are
+ * read from the in-process GStreamer registry through GstRegistryBackend
+ * instead, behind the same interface and signals.
  */
 class GstInspectParser : public QObject {
     Q_OBJECT
 
   public:
+    /**
+     * @enum DiscoveryMode
+     * @brief How a full scan runs gst-inspect-1.0
+     */
+    enum class DiscoveryMode : quint8 {
+        PrintAll, ///< One gst-inspect-1.0 --print-all process
+        PerPlugin ///< Concurrent gst-inspect-1.0 processes per plugin file, then per element
+    };
+
     /**
      * @brief Constructs a new GstInspectParser
      * @param parent Parent QObject
@@ -37,10 +61,134 @@ class GstInspectParser : public QObject {
     explicit GstInspectParser(QObject* parent = nullptr);
 
     /**
-     * @brief Parse all available GStreamer elements
-     * @return true if parsing was successful, false otherwise
+     * @brief Start asynchronous discovery of all available GStreamer elements
+     *
+     * If @p useCache is set and the on-disk cache matches the installed
+     * plugins, the cached catalog is loaded and parsingFinished() is emitted
+     * before this function returns. If only a few plugin files changed since
+     * the cache was written, just those plugins are re-inspected and the
+     * catalog is patched, reported through elementAdded(), elementRemoved()
+     * and elementUpdated(). Otherwise the catalog is emptied, reported
+     * through catalogReset(), a full scan is started as selected by
+     * discoveryMode() and this function returns immediately. Output is
+     * consumed incrementally; elementParsed() and parsingProgress() are
+     * emitted as elements complete, followed by parsingFinished() or
+     * parsingFailed(). A successful scan refreshes the cache.
+     *
+     * Sections are only parsed up to the factory and plugin details during
+     * the scan. Properties and pad templates are parsed on first access
+     * through getElement() or ahead of time through prefetchDetails().
+     *
+     * @param useCache Whether an up-to-date cache may satisfy the request
+     * @return true if the catalog was loaded or the inspect process was started, false otherwise
+     */
+    bool parseAllElements(bool useCache = true);
+
+    /**
+     * @brief Replace the catalog with the elements of recorded gst-inspect-1.0 output
+     *
+     * Lets catalogs of other machines, e.g. output collected from build
+     * images, be loaded without running GStreamer locally. Headers are
+     * parsed before this function returns; details on first access as after
+     * parseAllElements(). elementParsed() is emitted per element and
+     * parsingProgress() once, followed by catalogReset(). The cache is
+     * neither read nor written.
+     *
+     * @param output Complete gst-inspect-1.0 --print-all output
+     * @return false if a discovery is running, true otherwise
+     */
+    bool loadOutput(QByteArrayView output);
+
+    /**
+     * @brief Parse recorded gst-inspect-1.0 output without touching the catalog
+     *
+     * Sections are parsed completely, details included, on the global
+     * thread pool. Safe to call from any thread.
+     *
+     * @param output Complete gst-inspect-1.0 --print-all output
+     * @return Elements in output order
+     */
+    static QList<GstElement> parseOutput(QByteArrayView output);
+
+    /**
+     * @brief Abort a running discovery started with parseAllElements()
+     *
+     * Elements parsed so far are kept. parsingFailed() is emitted once the
+     * inspect process has been stopped.
+     */
+    void cancelParsing();
+
+    /**
+     * @brief Check whether an asynchronous discovery is running
+     * @return true while the inspect process is active or sections are still being parsed
+     */
+    [[nodiscard]] bool isParsing() const;
+
+    /**
+     * @brief Set the location of the on-disk catalog cache
+     * @param path Cache file path; an empty path disables caching
+     */
+    void setCacheFilePath(const QString& path);
+
+    /**
+     * @brief Get the location of the on-disk catalog cache
+     * @return Cache file path, empty if caching is disabled
+     */
+    [[nodiscard]] QString cacheFilePath() const;
+
+    /**
+     * @brief Set the number of worker threads used to parse element sections
+     *
+     * Sections are parsed concurrently but merged in output order, so the
+     * resulting catalog and signal order do not depend on the worker count.
+     *
+     * @param count Number of workers; values below 1 select QThread::idealThreadCount()
+     */
+    void setWorkerCount(int count);
+
+    /**
+     * @brief Get the number of worker threads used to parse element sections
+     * @return Worker count
      */
-    static bool parseAllElements();
+    [[nodiscard]] int workerCount() const;
+
+    /**
+     * @brief Select how a full scan runs gst-inspect-1.0
+     *
+     * A single --print-all process inspects one element after the other.
+     * PerPlugin lists the plugin files first and inspects each of them, and
+     * then each element they provide, in a bounded pool of concurrent
+     * processes; elements are parsed on the worker threads as their process
+     * completes. Ignored by the registry backend, which runs in-process.
+     *
+     * @param mode Discovery mode, PrintAll unless changed
+     */
+    void setDiscoveryMode(DiscoveryMode mode);
+
+    /**
+     * @brief Get how a full scan runs gst-inspect-1.0
+     * @return Discovery mode
+     */
+    [[nodiscard]] DiscoveryMode discoveryMode() const;
+
+    /**
+     * @brief Set how long a single per-plugin or per-element inspection may run
+     *
+     * Applies to incremental refreshes and PerPlugin scans. An inspection
+     * that runs longer is killed, and only the elements it would have
+     * reported are missing from the catalog. The single run that brings
+     * the GStreamer registry up to date before the inspections start is
+     * not limited.
+     *
+     * @param msecs Timeout in milliseconds; 0 lets inspections run indefinitely
+     */
+    void setInspectTimeout(int msecs);
+
+    /**
+     * @brief Get how long a single per-plugin or per-element inspection may run
+     * @return Timeout in milliseconds, 0 if inspections run indefinitely
+     */
+    [[nodiscard]] int inspectTimeout() const;
 
     /**
      * @brief Parse a specific GStreamer element
@@ -57,10 +205,31 @@ class GstInspectParser : public QObject {
 
     /**
      * @brief Get parsed element data by name
+     *
+     * Parses and memoizes the properties and pad templates of the element
+     * on first access.
+     *
      * @param name Element name
      * @return GstElement structure for the requested element
      */
-    [[nodiscard]] GstElement getElement(const QString& name) const;
+    [[nodiscard]] GstElement getElement(const QString& name);
+
+    /**
+     * @brief Get the factory and plugin details of an element without parsing its details
+     * @param name Element name
+     * @return Element whose properties and pad templates may be empty
+     */
+    [[nodiscard]] GstElement getElementHeader(const QString& name) const;
+
+    /**
+     * @brief Parse the details of elements in the background
+     *
+     * Elements whose details are already parsed or being parsed are skipped.
+     * Results are memoized for later getElement() calls.
+     *
+     * @param names Element names, e.g. the neighbours of the current selection
+     */
+    void prefetchDetails(const QStringList& names);
 
     /**
      * @brief Get elements filtered by classification
@@ -69,11 +238,46 @@ class GstInspectParser : public QObject {
      */
     [[nodiscard]] QStringList getElementsByClassification(const QString& classification) const;
 
+    /**
+     * @brief Get a function returning all elements with their details
+     *
+     * The function holds a snapshot of the current catalog and may be called
+     * from any thread. Details that have not been parsed yet are parsed when
+     * it is called, so call it from a worker.
+     *
+     * @return Function returning the elements sorted by name
+     */
+    [[nodiscard]] std::function<QList<GstElement>()> elementLoader() const;
+
+    /**
+     * @struct Stages
+     * @brief Single parsing stages, for the benchmarks
+     *
+     * Internal interface; the application goes through parseAllElements(),
+     * loadOutput() and parseOutput(). Nothing is interned or memoized.
+     */
+    struct Stages {
+        /// Parse one element section completely, see parseOutput()
+        static GstElement parseElementDetails(const QString& output) {
+            return GstInspectParser::parseElementDetails(output);
+        }
+
+        /// Parse an "Element Properties:" section body into @p element
+        static void parseProperties(QStringView section, GstElement& element) {
+            GstInspectParser::parseProperties(section, element);
+        }
+
+        /// Parse a "Pad Templates:" section body into @p element
+        static void parsePadTemplates(QStringView section, GstElement& element) {
+            GstInspectParser::parsePadTemplates(section, element);
+        }
+    };
+
   signals:
     /**
      * @brief Emitted during parsing to indicate progress
      * @param current Current number of elements parsed
-     * @param total Total number of elements to parse
+     * @param total Expected number of elements (size of the previous catalog), 0 if unknown
      */
     void parsingProgress(int current, int total);
 
@@ -88,6 +292,38 @@ class GstInspectParser : public QObject {
      */
     void elementParsed(const QString& elementName);
 
+    /**
+     * @brief Emitted when discovery could not be completed
+     * @param errorMessage Human-readable reason (process error or cancellation)
+     */
+    void parsingFailed(const QString& errorMessage);
+
+    /**
+     * @brief Emitted when the catalog has been replaced as a whole, e.g. loaded from the cache
+     *
+     * Also emitted with an empty catalog when a full scan starts, so no
+     * element of the previous catalog is looked up while it is rebuilt.
+     */
+    void catalogReset();
+
+    /**
+     * @brief Emitted when an incremental refresh finds an element of a new or changed plugin
+     * @param elementName Name of the added element
+     */
+    void elementAdded(const QString& elementName);
+
+    /**
+     * @brief Emitted when an incremental refresh drops an element of a removed or changed plugin
+     * @param elementName Name of the removed element
+     */
+    void elementRemoved(const QString& elementName);
+
+    /**
+     * @brief Emitted when an incremental refresh re-inspects an element of a changed plugin
+     * @param elementName Name of the updated element
+     */
+    void elementUpdated(const QString& elementName);
+
   private slots:
     /**
      * @brief Called when the gst-inspect process finishes
@@ -96,16 +332,214 @@ class GstInspectParser : public QObject {
      */
     void onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus);
 
+    /**
+     * @brief Called when the gst-inspect process has new output available
+     */
+    void onReadyReadStandardOutput();
+
+    /**
+     * @brief Called when the gst-inspect process fails to start or crashes
+     * @param error Process error
+     */
+    void onProcessErrorOccurred(QProcess::ProcessError error);
+
+    /**
+     * @brief Called when a batch of sections has been parsed by the thread pool
+     */
+    void onBatchFinished();
+
+    /**
+     * @brief Called when a plugin or element inspection of an incremental refresh completes
+     * @param arguments gst-inspect-1.0 arguments of the job
+     * @param output Standard output of the job
+     * @param success Whether the job succeeded
+     */
+    void onJobFinished(const QStringList& arguments, const QByteArray& output, bool success);
+
+    /**
+     * @brief Called when all inspections of an incremental refresh have completed
+     */
+    void onJobQueueFinished();
+
   private:
-    QMap<QString, GstElement> m_elements; ///< Cache of parsed elements
-    QProcess* m_process;                  ///< Process for running gst-inspect
-    QString m_currentOutput;              ///< Current output from gst-inspect
+    QMap<QString, GstElement> m_elements;                    ///< Elements parsed in this session
+    GstMappedCatalog m_catalog;                              ///< Cached catalog, used while m_elements is empty
+    QProcess* m_process;                                     ///< Process for running gst-inspect
+    GstInspectSectionSplitter m_splitter;                    ///< Incremental splitter for the running discovery
+    QThreadPool* m_threadPool;                               ///< Workers parsing element sections
+    QList<QFutureWatcher<GstElement>*> m_pendingBatches;     ///< Batches in flight, in output order
+    QString m_failureMessage;                                ///< Error to report once pending batches are merged
+    QString m_cacheFilePath;                                 ///< On-disk catalog cache, empty if disabled
+    int m_parsedCount = 0;                                   ///< Elements parsed during the running discovery
+    int m_dispatchedCount = 0;                               ///< Sections handed to the thread pool
+    int m_expectedCount = 0;                                 ///< Element count of the previous discovery, 0 if unknown
+    bool m_cancelled = false;                                ///< Whether the running discovery was cancelled
+    bool m_outputComplete = false;                           ///< Whether the inspect process has delivered all output
+    GstInspectJobQueue* m_jobQueue;                          ///< Inspections of an incremental refresh or plugin scan
+    QSet<QString> m_pendingPluginFiles;                      ///< Plugin files awaiting their feature list
+    QSet<QString> m_scheduledElements;                       ///< Elements queued for inspection by the plugin scan
+    DiscoveryMode m_discoveryMode = DiscoveryMode::PrintAll; ///< How a full scan runs gst-inspect-1.0
+    bool m_incrementalRefresh = false;                       ///< Whether an incremental refresh is running
+    bool m_pluginScan = false;                               ///< Whether a plugin scan still has inspections queued
+    QHash<QString, QString> m_detailSections;                ///< Section text of elements whose details are unparsed
+    QSet<QString> m_prefetching;                             ///< Elements whose details are parsed in the background
+    int m_detailGeneration = 0;                              ///< Incremented whenever m_detailSections is discarded
+    std::shared_ptr<GstStringPool> m_stringPool;             ///< Repetitive strings shared by the catalog elements
+
+    /**
+     * @brief Dispatch completed element sections to the thread pool
+     * @param sections Sections handed out by the splitter, in output order
+     */
+    void processSections(const QList<GstInspectSection>& sections);
+
+    /**
+     * @brief Keep section text for parsing element details later
+     * @param sections Sections whose headers are being parsed
+     */
+    void deferDetails(const QList<GstInspectSection>& sections);
+
+    /**
+     * @brief Drop all elements, their unparsed details and the strings they share
+     */
+    void resetCatalog();
+
+    /**
+     * @brief Drop all unparsed details and invalidate running prefetches
+     */
+    void resetDetails();
+
+    /**
+     * @brief Parse the details of an element if they are still pending
+     * @param name Element name
+     */
+    void loadDetails(const QString& name);
+
+    /**
+     * @brief Track a batch of elements being produced on the thread pool
+     * @param future Elements of the batch, in catalog order
+     * @param count Number of elements in the batch
+     */
+    void dispatchBatch(const QFuture<GstElement>& future, int count);
+
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+    /**
+     * @brief Read all element factories from the in-process GStreamer registry
+     *
+     * Failures are reported through parsingFailed(), like a failed process start.
+     */
+    void startRegistryScan();
+#endif
+
+    /**
+     * @brief Store parsed elements in the catalog and report progress
+     * @param elements Parsed elements, in output order
+     */
+    void mergeElements(const QList<GstElement>& elements);
+
+    /**
+     * @brief Emit the final signal once output is complete and all batches are merged
+     */
+    void completeIfIdle();
+
+    /**
+     * @brief Cancel and discard batches that have not been merged yet
+     */
+    void discardPendingBatches();
+
+    /**
+     * @brief Map the on-disk catalog, regardless of whether it is up to date
+     * @return true if the cached catalog was mapped
+     */
+    bool openCache();
+
+    /**
+     * @brief Re-inspect only the plugin files that changed since the cache was written
+     * @return true if the refresh was started, false if a full scan is needed instead
+     */
+    bool startIncrementalRefresh();
+
+    /**
+     * @brief Start a full scan that inspects plugin files and their elements in concurrent processes
+     *
+     * Failures are reported through parsingFailed(), like a failed process start.
+     */
+    void startPluginScan();
+
+    /**
+     * @brief Copy the mapped catalog into m_elements so it can be patched
+     */
+    void materializeCatalog();
+
+    /**
+     * @brief Remove elements provided by a plugin file
+     * @param pluginFile Plugin file path
+     * @param keep Element names the plugin still provides
+     */
+    void removePluginElements(const QString& pluginFile, const QStringList& keep);
+
+    /**
+     * @brief Write the current catalog to the on-disk cache in the background
+     */
+    void saveCache();
+
+    /**
+     * @brief Parse deferred details into a copy of the catalog
+     * @param elements Elements to complete
+     * @param details Section text of elements whose details are unparsed
+     */
+    static void completeDetails(QMap<QString, GstElement>& elements, const QHash<QString, QString>& details);
+
+    /**
+     * @brief Extract the element names from the output of gst-inspect-1.0 for a plugin
+     * @param output Raw output of gst-inspect-1.0 <plugin>
+     * @return Names of the elements the plugin provides
+     */
+    static QStringList parsePluginFeatures(const QString& output);
+
+    /**
+     * @brief Parse the complete output of gst-inspect-1.0 for a single element
+     * @param elementName Element name
+     * @param output Raw output of gst-inspect-1.0 <element>
+     * @return Element with its details
+     */
+    static GstElement parseElementOutput(const QString& elementName, const QByteArray& output);
+
+    /**
+     * @brief Prefix every line of single-element output with the element name
+     *
+     * gst-inspect-1.0 only prefixes lines with "name: " in --print-all mode;
+     * the detail parsers expect that layout.
+     *
+     * @param elementName Element name
+     * @param output Raw output of gst-inspect-1.0 <element>
+     * @return Output in --print-all layout
+     */
+    static QString prefixElementOutput(const QString& elementName, const QString& output);
+
+    /**
+     * @brief Parse the factory and plugin details of a single element section
+     * @param section Section handed out by the splitter
+     * @return Element named after the section header, without properties and pad templates
+     */
+    static GstElement parseSection(const GstInspectSection& section);
+
+    /**
+     * @brief Parse the properties and pad templates of a single element section
+     * @param section Section handed out by the splitter
+     * @return Element holding only name, properties and pad templates
+     */
+    static GstElement parseSectionDetails(const GstInspectSection& section);
+
+    /**
+     * @brief Reset incremental parsing state
+     */
+    void resetStreamState();
 
     /**
      * @brief Parse the list of all available elements
-     * @param output Raw output from gst-inspect-1.0
+     * @param output Complete raw output from gst-inspect-1.0 --print-all
      */
-    void parseElementList(const QString& output);
+    void parseElementList(QByteArrayView output);
 
     /**
      * @brief Parse detailed information for a specific element
@@ -114,33 +548,94 @@ class GstInspectParser : public QObject {
      */
     static GstElement parseElementDetails(const QString& output);
 
+    /**
+     * @brief Parse factory details, plugin details and signals of element output
+     *
+     * Signals are few and short, and parsing them with the header lets the
+     * element search match signal names before any details are loaded.
+     *
+     * @param output Raw output in --print-all layout
+     * @return GstElement structure without properties and pad templates
+     */
+    static GstElement parseElementHeader(const QString& output);
+
+    /**
+     * @brief Parse properties, pad templates and URI handling of element output
+     * @param output Raw output in --print-all layout
+     * @param element Element to populate
+     */
+    static void parseElementBody(const QString& output, GstElement& element);
+
+    /**
+     * @brief Parse factory details, plugin details and signals of indexed element output
+     * @param sections Section index of the element output
+     * @param element Element to populate
+     */
+    static void parseElementHeader(const GstInspectSectionIndex& sections, GstElement& element);
+
+    /**
+     * @brief Parse the detail sections of indexed element output
+     * @param sections Section index of the element output
+     * @param element Element to populate
+     */
+    static void parseElementBody(const GstInspectSectionIndex& sections, GstElement& element);
+
     /**
      * @brief Parse properties section of element output
      * @param section Properties section text
      * @param element Element to populate with properties
      */
-    static void parseProperties(const QString& section, GstElement& element);
+    static void parseProperties(QStringView section, GstElement& element);
 
     /**
      * @brief Parse pad templates section of element output
      * @param section Pad templates section text
      * @param element Element to populate with pad templates
      */
-    static void parsePadTemplates(const QString& section, GstElement& element);
+    static void parsePadTemplates(QStringView section, GstElement& element);
+
+    /**
+     * @brief Parse URI handling capabilities section of element output
+     * @param section URI handling section text
+     * @param element Element to populate with URI type and protocols
+     */
+    static void parseUriHandling(QStringView section, GstElement& element);
+
+    /**
+     * @brief Parse an element signals or actions section
+     * @param section Signals or actions section text
+     * @param kind Kind of the signals in the section
+     * @return Signal descriptors in output order
+     */
+    static QList<GstSignal> parseSignals(QStringView section, GstSignal::Kind kind);
+
+    /**
+     * @brief Split a property start line into name and description
+     * @param line Trimmed line like "automatic-eos       : Automatically EOS when the segment is done"
+     * @param name Receives the property name
+     * @param description Receives the description
+     * @return true if the line starts a property
+     */
+    static bool parsePropertyStart(QStringView line, QStringView& name, QStringView& description);
 
     /**
-     * @brief Parse a single property from text
-     * @param propertyText Raw property text
-     * @return GstProperty structure
+     * @brief Apply a detail line below a property start line
+     *
+     * Flags, type, enum type and enum value lines are told apart by their
+     * first characters and split by hand. Lines deviating from the layout
+     * gst-inspect-1.0 prints go through matchPropertyDetail() instead.
+     *
+     * @param line Trimmed detail line
+     * @param property Property to update
      */
-    static GstProperty parseProperty(const QString& propertyText);
+    static void parsePropertyDetail(QStringView line, GstProperty& property);
 
     /**
-     * @brief Parse a single pad template from text
-     * @param padText Raw pad template text
-     * @return GstPadTemplate structure
+     * @brief Apply a detail line using regular expressions, for lines parsePropertyDetail() cannot split
+     * @param line Trimmed detail line
+     * @param property Property to update
      */
-    static GstPadTemplate parsePadTemplate(const QString& padText);
+    static void matchPropertyDetail(QStringView line, GstProperty& property);
 
     /**
      * @brief Process pad template header line
@@ -150,7 +645,7 @@ class GstInspectParser : public QObject {
      * @param inCapabilities Reference to capabilities parsing state
      * @return true if line was processed as header, false otherwise
      */
-    static bool processPadTemplateHeader(const QString& line, GstPadTemplate& currentPad, GstElement& element,
+    static bool processPadTemplateHeader(QStringView line, GstPadTemplate& currentPad, GstElement& element,
                                          bool& inCapabilities);
 
     /**
@@ -159,31 +654,42 @@ class GstInspectParser : public QObject {
      * @param pad Pad template to update
      * @return true if line was processed, false otherwise
      */
-    static bool processAvailabilityLine(const QString& trimmedLine, GstPadTemplate& pad);
+    static bool processAvailabilityLine(QStringView trimmedLine, GstPadTemplate& pad);
 
     /**
      * @brief Process capabilities section
-     * @param trimmedLine Trimmed input line
+     *
+     * Collects every caps line below "Capabilities:" into GstPadTemplate::m_caps
+     * as one structure line followed by its "field: value" lines, the layout
+     * GstCaps::parse() expects. Wrapped list values are joined back into one line.
+     *
+     * @param line Input line, possibly prefixed with the element name
      * @param currentPad Current pad template being built
      * @param inCapabilities Reference to capabilities parsing state
      * @return true if line was processed, false otherwise
      */
-    static bool processCapabilitiesSection(const QString& trimmedLine, GstPadTemplate& currentPad,
-                                           bool& inCapabilities);
+    static bool processCapabilitiesSection(QStringView line, GstPadTemplate& currentPad, bool& inCapabilities);
 
     /**
      * @brief Check if line contains capability information
-     * @param line Line to check
-     * @return true if line contains capability data
+     * @param content Line without element name prefix
+     * @return true if line is indented like caps below "Capabilities:"
+     */
+    static bool isCapabilityLine(QStringView content);
+
+    /**
+     * @brief Append a caps line, joining continuations of wrapped values
+     * @param caps Caps text collected so far
+     * @param line Trimmed caps line
      */
-    static bool isCapabilityLine(const QString& line);
+    static void appendCapsLine(QString& caps, QStringView line);
 
     /**
      * @brief Check if line indicates end of current section
      * @param line Line to check
      * @return true if line indicates section end
      */
-    static bool isSectionEnd(const QString& line);
+    static bool isSectionEnd(QStringView line);
 
     /**
      * @brief Finalize and add pad template to element
@@ -191,49 +697,6 @@ class GstInspectParser : public QObject {
      * @param element Element to add pad template to
      */
     static void finalizePadTemplate(GstPadTemplate& pad, GstElement& element);
-
-    /**
-     * @brief Parse pad name and direction from line
-     * @param line Line to parse
-     * @param pad Pad template to update
-     */
-    static void parsePadNameAndDirection(const QString& line, GstPadTemplate& pad);
-
-    /**
-     * @brief Process capability line for pad template
-     * @param line Line to process
-     * @param pad Pad template to update
-     */
-    static void processCapabilityLine(const QString& line, GstPadTemplate& pad);
-
-    /**
-     * @brief Extract a section from gst-inspect output
-     * @param text Full text to search
-     * @param sectionName Name of section to extract
-     * @return Extracted section text
-     */
-    static QString extractSection(const QString& text, const QString& sectionName);
-
-    /**
-     * @brief Split text into sections using delimiter
-     * @param text Text to split
-     * @param delimiter Delimiter to use
-     * @return QStringList of sections
-     */
-    static QStringList splitIntoSections(const QString& text, const QString& delimiter);
-
-    /**
-     * @brief Clean up text by removing extra whitespace
-     * @param text Text to clean
-     * @return Cleaned text
-     */
-    static QString cleanupText(const QString& text);
-
-    /**
-     * @brief Utility function for section extraction
-     * @return Empty string
-     */
-    static QString extracted();
 };
 
 } // namespace GstStudio
@@ -0,0 +1,219 @@
+#include "gstinspectsplitter.h"
+#include <algorithm>
+
+namespace GstStudio {
+
+namespace {
+
+constexpr QByteArrayView kFactoryDetailsHeader("Factory Details:");
+
+bool isElementNameChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+}
+
+void appendSection(QByteArrayView data, qsizetype start, qsizetype end, const QByteArray& name,
+                   QList<GstInspectSection>& sections) {
+    // Drop the newline terminating the last line of the section
+    if (end > start && data.at(end - 1) == '\n') {
+        --end;
+    }
+
+    GstInspectSection section;
+    section.m_elementName = QString::fromUtf8(name);
+    section.m_text = QString::fromUtf8(data.sliced(start, end - start));
+    sections.append(section);
+}
+
+} // namespace
+
+QList<GstInspectSection> GstStudio::GstInspectSectionSplitter::feed(QByteArrayView chunk) {
+    QList<GstInspectSection> sections;
+    m_bytesConsumed += chunk.size();
+    m_buffer.append(chunk);
+    scan(m_buffer, m_scanPos, m_sectionStart, m_sectionName, false, sections);
+
+    // Everything before the open section has been handed out; compact once per chunk
+    const qsizetype keepFrom = m_sectionStart >= 0 ? m_sectionStart : m_scanPos;
+    if (keepFrom > 0) {
+        m_buffer.remove(0, keepFrom);
+        m_scanPos -= keepFrom;
+        if (m_sectionStart >= 0) {
+            m_sectionStart -= keepFrom;
+        }
+    }
+
+    return sections;
+}
+
+QList<GstInspectSection> GstStudio::GstInspectSectionSplitter::finish() {
+    QList<GstInspectSection> sections;
+    scan(m_buffer, m_scanPos, m_sectionStart, m_sectionName, true, sections);
+    reset();
+    return sections;
+}
+
+void GstStudio::GstInspectSectionSplitter::reset() {
+    m_buffer.clear();
+    m_sectionName.clear();
+    m_scanPos = 0;
+    m_sectionStart = -1;
+    m_bytesConsumed = 0;
+}
+
+QList<GstInspectSection> GstStudio::GstInspectSectionSplitter::split(QByteArrayView output) {
+    QList<GstInspectSection> sections;
+    qsizetype scanPos = 0;
+    qsizetype sectionStart = -1;
+    QByteArray sectionName;
+    scan(output, scanPos, sectionStart, sectionName, true, sections);
+    return sections;
+}
+
+QByteArrayView GstStudio::GstInspectSectionSplitter::headerElementName(QByteArrayView line) {
+    // Header lines look like "videotestsrc: Factory Details:"
+    qsizetype nameEnd = 0;
+    while (nameEnd < line.size() && isElementNameChar(line.at(nameEnd))) {
+        ++nameEnd;
+    }
+    if (nameEnd == 0 || nameEnd >= line.size() || line.at(nameEnd) != ':') {
+        return {};
+    }
+
+    qsizetype pos = nameEnd + 1;
+    const qsizetype spacesStart = pos;
+    while (pos < line.size() && (line.at(pos) == ' ' || line.at(pos) == '\t')) {
+        ++pos;
+    }
+    if (pos == spacesStart || !line.sliced(pos).startsWith(kFactoryDetailsHeader)) {
+        return {};
+    }
+
+    return line.first(nameEnd);
+}
+
+void GstStudio::GstInspectSectionSplitter::scan(QByteArrayView data, qsizetype& scanPos, qsizetype& sectionStart,
+                                                QByteArray& sectionName, bool flush,
+                                                QList<GstInspectSection>& sections) {
+    while (scanPos < data.size()) {
+        qsizetype lineEnd = data.indexOf('\n', scanPos);
+        const bool complete = lineEnd != -1;
+        if (!complete) {
+            if (!flush) {
+                break;
+            }
+            lineEnd = data.size();
+        }
+
+        QByteArrayView line = data.sliced(scanPos, lineEnd - scanPos);
+        if (line.endsWith('\r')) {
+            line.chop(1);
+        }
+
+        const QByteArrayView name = headerElementName(line);
+        if (!name.isEmpty()) {
+            if (sectionStart >= 0) {
+                appendSection(data, sectionStart, scanPos, sectionName, sections);
+            }
+            sectionStart = scanPos;
+            sectionName = name.toByteArray();
+        }
+
+        scanPos = complete ? lineEnd + 1 : lineEnd;
+    }
+
+    if (flush && sectionStart >= 0) {
+        appendSection(data, sectionStart, data.size(), sectionName, sections);
+        sectionStart = -1;
+        sectionName.clear();
+    }
+}
+
+GstStudio::GstInspectSectionIndex::GstInspectSectionIndex(QStringView text) : m_text(text) {
+    m_begin.fill(-1);
+    m_end.fill(-1);
+
+    // Index of the section whose body is open, or -1 while inside an unnamed block
+    qsizetype open = -1;
+    qsizetype lineStart = 0;
+    while (lineStart < text.size()) {
+        qsizetype lineEnd = text.indexOf(u'\n', lineStart);
+        lineEnd = lineEnd == -1 ? text.size() : lineEnd;
+        const QStringView content = stripElementPrefix(text.sliced(lineStart, lineEnd - lineStart));
+        const qsizetype nextLine = std::min(lineEnd + 1, text.size());
+
+        // Titles start in the first column after the prefix and end with a colon; detail lines are indented
+        const bool indented = content.size() > 1 && content.at(0).isSpace() && content.at(1).isSpace();
+        const QStringView trimmed = content.trimmed();
+        if (!indented && trimmed.size() > 1 && trimmed.endsWith(u':') && !trimmed.at(0).isSpace()) {
+            if (open >= 0) {
+                m_end[open] = lineStart;
+                open = -1;
+            }
+            for (size_t i = 0; i < kSectionCount; ++i) {
+                if (m_begin.at(i) < 0 && trimmed == title(static_cast<Section>(i))) {
+                    m_begin[i] = nextLine;
+                    open = static_cast<qsizetype>(i);
+                    break;
+                }
+            }
+        }
+        lineStart = nextLine;
+        if (lineEnd == text.size()) {
+            break;
+        }
+    }
+
+    if (open >= 0) {
+        m_end[open] = text.size();
+    }
+}
+
+QStringView GstStudio::GstInspectSectionIndex::section(Section section) const {
+    const auto i = static_cast<size_t>(section);
+    if (i >= kSectionCount || m_begin.at(i) < 0) {
+        return {};
+    }
+    return m_text.sliced(m_begin.at(i), m_end.at(i) - m_begin.at(i));
+}
+
+QStringView GstStudio::GstInspectSectionIndex::title(Section section) {
+    switch (section) {
+        case Section::FactoryDetails:
+            return u"Factory Details:";
+        case Section::PluginDetails:
+            return u"Plugin Details:";
+        case Section::ElementFlags:
+            return u"Element Flags:";
+        case Section::PadTemplates:
+            return u"Pad Templates:";
+        case Section::UriHandling:
+            return u"URI handling capabilities:";
+        case Section::ElementProperties:
+            return u"Element Properties:";
+        case Section::ElementSignals:
+            return u"Element Signals:";
+        case Section::ElementActions:
+            return u"Element Actions:";
+        default:
+            return {};
+    }
+}
+
+QStringView GstStudio::GstInspectSectionIndex::stripElementPrefix(QStringView line) {
+    // --print-all prefixes every line with "elementname:"
+    qsizetype nameEnd = 0;
+    while (nameEnd < line.size() && (line.at(nameEnd).isLetterOrNumber() || line.at(nameEnd) == u'_' ||
+                                     line.at(nameEnd) == u'-')) {
+        ++nameEnd;
+    }
+    if (nameEnd == 0 || nameEnd >= line.size() || line.at(nameEnd) != u':') {
+        return line;
+    }
+    if (nameEnd + 1 < line.size() && !line.at(nameEnd + 1).isSpace()) {
+        return line;
+    }
+    return line.sliced(nameEnd + 1);
+}
+
+} // namespace GstStudio
+
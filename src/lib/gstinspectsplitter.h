@@ -0,0 +1,170 @@
+/**
+ * @file gstinspectsplitter.h
+ * @brief Single-pass splitter for gst-inspect-1.0 --print-all output
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QList>
+#include <QString>
+#include <QStringView>
+#include <array>
+
+namespace GstStudio {
+
+/**
+ * @struct GstInspectSection
+ * @brief Output of gst-inspect-1.0 belonging to a single element
+ */
+struct GstInspectSection {
+    QString m_elementName; ///< Element name taken from the "Factory Details:" header
+    QString m_text;        ///< Complete section text, header line included
+};
+
+/**
+ * @class GstInspectSectionSplitter
+ * @brief Splits --print-all output into per-element sections in one forward pass
+ *
+ * Every byte is scanned exactly once. Lines are classified in place on the
+ * raw UTF-8 buffer and only the finished section is decoded into a QString,
+ * so no intermediate line lists or joins are created. Output can be fed in
+ * arbitrary chunks as it arrives from the inspect process.
+ */
+class GstInspectSectionSplitter {
+  public:
+    /**
+     * @brief Feed a chunk of raw output
+     * @param chunk Bytes read from gst-inspect-1.0, may end in the middle of a line
+     * @return Sections completed by this chunk, in output order
+     */
+    QList<GstInspectSection> feed(QByteArrayView chunk);
+
+    /**
+     * @brief Signal end of output
+     * @return The last open section, if any
+     */
+    QList<GstInspectSection> finish();
+
+    /**
+     * @brief Discard buffered output and start over
+     */
+    void reset();
+
+    /**
+     * @brief Get number of bytes fed since the last reset
+     * @return Consumed byte count
+     */
+    [[nodiscard]] qint64 bytesConsumed() const {
+        return m_bytesConsumed;
+    }
+
+    /**
+     * @brief Split a complete output buffer without copying it
+     * @param output Complete --print-all output
+     * @return All element sections, in output order
+     */
+    static QList<GstInspectSection> split(QByteArrayView output);
+
+    /**
+     * @brief Extract the element name from a "name: Factory Details:" header line
+     * @param line Single output line without newline
+     * @return Element name, or an empty view if the line is not a section header
+     */
+    static QByteArrayView headerElementName(QByteArrayView line);
+
+  private:
+    QByteArray m_buffer;           ///< Open section plus trailing partial line
+    QByteArray m_sectionName;      ///< Name of the open section, empty if none
+    qsizetype m_scanPos = 0;       ///< First byte in m_buffer not yet classified
+    qsizetype m_sectionStart = -1; ///< Start of the open section in m_buffer, -1 if none
+    qint64 m_bytesConsumed = 0;    ///< Total bytes fed
+
+    /**
+     * @brief Classify lines of a buffer and collect completed sections
+     * @param data Buffer to scan
+     * @param scanPos First unscanned byte, advanced past every complete line
+     * @param sectionStart Start of the open section, -1 if none
+     * @param sectionName Name of the open section
+     * @param flush true to treat a trailing partial line as complete and close the open section
+     * @param sections Receives completed sections
+     */
+    static void scan(QByteArrayView data, qsizetype& scanPos, qsizetype& sectionStart, QByteArray& sectionName,
+                     bool flush, QList<GstInspectSection>& sections);
+};
+
+/**
+ * @class GstInspectSectionIndex
+ * @brief Locates the titled blocks of one element's output in a single scan
+ *
+ * The output of an element consists of blocks introduced by an unindented
+ * title line such as "Pad Templates:". The constructor records where every
+ * title starts and ends in one forward pass; section() then hands out views
+ * into the indexed text without copying it. Titles the index does not name,
+ * like "Pads:" or "Clocking Interaction:", still end the block before them.
+ */
+class GstInspectSectionIndex {
+  public:
+    /**
+     * @enum Section
+     * @brief Blocks of the output that are indexed by title
+     */
+    enum class Section : quint8 {
+        FactoryDetails,    ///< "Factory Details:"
+        PluginDetails,     ///< "Plugin Details:"
+        ElementFlags,      ///< "Element Flags:"
+        PadTemplates,      ///< "Pad Templates:"
+        UriHandling,       ///< "URI handling capabilities:"
+        ElementProperties, ///< "Element Properties:"
+        ElementSignals,    ///< "Element Signals:"
+        ElementActions,    ///< "Element Actions:"
+        Count              ///< Number of indexed sections
+    };
+
+    /**
+     * @brief Index the sections of an element's output
+     * @param text Output of one element, optionally prefixed with "elementname:"; must outlive the index
+     */
+    explicit GstInspectSectionIndex(QStringView text);
+
+    /**
+     * @brief Get the body of a section
+     * @param section Section to look up
+     * @return Lines after the title up to the next title, or an empty view if the section is missing
+     */
+    [[nodiscard]] QStringView section(Section section) const;
+
+    /**
+     * @brief Check whether a section was found
+     * @param section Section to look up
+     * @return true if its title occurs in the text
+     */
+    [[nodiscard]] bool contains(Section section) const {
+        return m_begin.at(static_cast<size_t>(section)) >= 0;
+    }
+
+    /**
+     * @brief Get the title line of a section
+     * @param section Section
+     * @return Title as printed, e.g. "Pad Templates:"
+     */
+    static QStringView title(Section section);
+
+    /**
+     * @brief Remove the "elementname:" prefix of --print-all output
+     * @param line Output line
+     * @return Line content after the prefix, or the line itself if it has none
+     */
+    static QStringView stripElementPrefix(QStringView line);
+
+  private:
+    static constexpr size_t kSectionCount = static_cast<size_t>(Section::Count);
+
+    QStringView m_text;                          ///< Indexed text
+    std::array<qsizetype, kSectionCount> m_begin; ///< Body start of each section, -1 if missing
+    std::array<qsizetype, kSectionCount> m_end;   ///< Body end of each section
+};
+
+} // namespace GstStudio
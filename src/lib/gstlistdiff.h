@@ -0,0 +1,113 @@
+/**
+ * @file gstlistdiff.h
+ * @brief Keyed list diff applying minimal row changes to a list model
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QList>
+#include <QModelIndex>
+#include <QSet>
+#include <QString>
+#include <utility>
+
+namespace GstStudio {
+
+/**
+ * @brief Turn the rows of a list model into a new list with minimal notifications
+ *
+ * Rows are matched by m_name. Rows whose name is gone are removed, new names
+ * are inserted, rows that changed position are moved and rows whose value
+ * changed emit dataChanged(); unchanged rows emit nothing, so views keep
+ * their delegates. Afterwards @p items shares its data with @p target.
+ *
+ * The model must declare this function a friend, since the row
+ * notifications of QAbstractItemModel are protected.
+ *
+ * @param model List model displaying @p items
+ * @param items Rows currently shown by the model, updated in step with the notifications
+ * @param target Rows to show
+ */
+template <typename Model, typename T>
+void applyKeyedDiff(Model& model, QList<T>& items, const QList<T>& target) {
+    QSet<QString> targetKeys;
+    targetKeys.reserve(target.size());
+    for (const T& item : target) {
+        targetKeys.insert(item.m_name);
+    }
+
+    // Remove rows whose key is gone, back to front and in contiguous ranges
+    for (int row = static_cast<int>(items.size()) - 1; row >= 0;) {
+        if (targetKeys.contains(items.at(row).m_name)) {
+            --row;
+            continue;
+        }
+
+        int first = row;
+        while (first > 0 && !targetKeys.contains(items.at(first - 1).m_name)) {
+            --first;
+        }
+        model.beginRemoveRows(QModelIndex(), first, row);
+        items.remove(first, row - first + 1);
+        model.endRemoveRows();
+        row = first - 1;
+    }
+
+    QSet<QString> currentKeys;
+    currentKeys.reserve(items.size());
+    for (const T& item : std::as_const(items)) {
+        currentKeys.insert(item.m_name);
+    }
+
+    // Walk the target, putting every row in place by update, move or insertion
+    for (int row = 0; row < target.size(); ++row) {
+        const T& wanted = target.at(row);
+
+        int from = -1;
+        for (int i = row; i < items.size(); ++i) {
+            if (items.at(i).m_name == wanted.m_name) {
+                from = i;
+                break;
+            }
+        }
+
+        if (from >= 0) {
+            if (from != row) {
+                model.beginMoveRows(QModelIndex(), from, from, QModelIndex(), row);
+                items.move(from, row);
+                model.endMoveRows();
+            }
+            if (items.at(row) != wanted) {
+                items[row] = wanted;
+                const QModelIndex changed = model.index(row, 0);
+                emit model.dataChanged(changed, changed);
+            }
+            continue;
+        }
+
+        int last = row;
+        while (last + 1 < target.size() && !currentKeys.contains(target.at(last + 1).m_name)) {
+            ++last;
+        }
+        model.beginInsertRows(QModelIndex(), row, last);
+        for (int i = row; i <= last; ++i) {
+            items.insert(i, target.at(i));
+            currentKeys.insert(target.at(i).m_name);
+        }
+        model.endInsertRows();
+        row = last;
+    }
+
+    // Only reached with duplicate keys: leftovers that matched an earlier row
+    if (items.size() > target.size()) {
+        model.beginRemoveRows(QModelIndex(), static_cast<int>(target.size()), static_cast<int>(items.size()) - 1);
+        items.resize(target.size());
+        model.endRemoveRows();
+    }
+
+    // Same content; share the data with the caller instead of keeping a detached copy
+    items = target;
+}
+
+} // namespace GstStudio
@@ -0,0 +1,482 @@
+#include "gstmappedcatalog.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QSaveFile>
+#include <algorithm>
+#include <cstring>
+
+namespace GstStudio {
+
+namespace {
+
+constexpr quint32 kCatalogMagic = 0x4753544d; // "GSTM"
+constexpr quint32 kCatalogVersion = 6;
+
+} // namespace
+
+struct GstMappedCatalog::StringRef {
+    quint32 m_offset = 0; ///< Offset into the string table, in UTF-16 code units
+    quint32 m_length = 0; ///< Length in UTF-16 code units
+};
+
+struct GstMappedCatalog::Header {
+    quint32 m_magic;
+    quint32 m_version;
+    quint32 m_fingerprintOffset;
+    quint32 m_fingerprintSize;
+    quint32 m_elementsOffset;
+    quint32 m_elementCount;
+    quint32 m_propertiesOffset;
+    quint32 m_propertyCount;
+    quint32 m_padsOffset;
+    quint32 m_padCount;
+    quint32 m_signalsOffset;
+    quint32 m_signalCount;
+    quint32 m_stringListsOffset;
+    quint32 m_stringListCount;
+    quint32 m_stringsOffset;
+    quint32 m_stringsLength; ///< In UTF-16 code units
+};
+
+struct GstMappedCatalog::ElementRecord {
+    StringRef m_name;
+    StringRef m_longName;
+    StringRef m_description;
+    StringRef m_author;
+    StringRef m_classification;
+    qint32 m_rank;
+    StringRef m_pluginName;
+    StringRef m_pluginFilename;
+    StringRef m_pluginVersion;
+    StringRef m_pluginLicense;
+    quint32 m_uriType; ///< GstElement::UriType
+    quint32 m_firstUriProtocol;
+    quint32 m_uriProtocolCount;
+    quint32 m_firstSignal;
+    quint32 m_signalCount;
+    quint32 m_firstProperty;
+    quint32 m_propertyCount;
+    quint32 m_firstPad;
+    quint32 m_padCount;
+};
+
+struct GstMappedCatalog::PropertyRecord {
+    StringRef m_name;
+    StringRef m_type;
+    StringRef m_description;
+    StringRef m_defaultValue;
+    StringRef m_range;
+    quint32 m_firstEnumValue;
+    quint32 m_enumValueCount;
+    quint32 m_flags; ///< Bit 0 readable, bit 1 writable, bit 2 controllable
+};
+
+struct GstMappedCatalog::PadRecord {
+    StringRef m_name;
+    StringRef m_caps;
+    quint8 m_direction; ///< GstPadTemplate::Direction
+    quint8 m_presence;  ///< GstPadTemplate::Presence
+    quint16 m_reserved;
+};
+
+struct GstMappedCatalog::SignalRecord {
+    StringRef m_name;
+    StringRef m_returnType;
+    quint32 m_firstArgumentType;
+    quint32 m_argumentTypeCount;
+    quint8 m_kind; ///< GstSignal::Kind
+    quint8 m_reserved[3];
+};
+
+namespace {
+
+/**
+ * Deduplicating string table builder; repeated type names, flags and caps
+ * are stored once.
+ */
+class StringTableBuilder {
+  public:
+    template <typename Ref> Ref add(const QString& text) {
+        Ref ref;
+        auto it = m_index.constFind(text);
+        if (it != m_index.constEnd()) {
+            ref.m_offset = it.value();
+        } else {
+            ref.m_offset = static_cast<quint32>(m_pool.size());
+            m_pool += text;
+            m_index.insert(text, ref.m_offset);
+        }
+        ref.m_length = static_cast<quint32>(text.size());
+        return ref;
+    }
+
+    [[nodiscard]] const QString& pool() const {
+        return m_pool;
+    }
+
+  private:
+    QHash<QString, quint32> m_index;
+    QString m_pool;
+};
+
+template <typename T> void appendRecords(QByteArray& data, const QList<T>& records) {
+    data.append(reinterpret_cast<const char*>(records.constData()),
+                static_cast<qsizetype>(records.size() * sizeof(T)));
+}
+
+void alignTo4(QByteArray& data) {
+    while (data.size() % 4 != 0) {
+        data.append('\0');
+    }
+}
+
+bool inBounds(qint64 size, quint32 offset, quint64 count, quint64 recordSize) {
+    return offset % 4 == 0 && static_cast<quint64>(offset) + count * recordSize <= static_cast<quint64>(size);
+}
+
+} // namespace
+
+GstStudio::GstMappedCatalog::~GstMappedCatalog() {
+    close();
+}
+
+bool GstStudio::GstMappedCatalog::open(const QString& path) {
+    close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    m_size = m_file.size();
+    if (m_size < static_cast<qint64>(sizeof(Header))) {
+        close();
+        return false;
+    }
+
+    m_data = m_file.map(0, m_size);
+    if (m_data == nullptr) {
+        close();
+        return false;
+    }
+
+    m_header = reinterpret_cast<const Header*>(m_data);
+    if (!validate()) {
+        close();
+        return false;
+    }
+
+    m_elements = reinterpret_cast<const ElementRecord*>(m_data + m_header->m_elementsOffset);
+    m_properties = reinterpret_cast<const PropertyRecord*>(m_data + m_header->m_propertiesOffset);
+    m_pads = reinterpret_cast<const PadRecord*>(m_data + m_header->m_padsOffset);
+    m_signals = reinterpret_cast<const SignalRecord*>(m_data + m_header->m_signalsOffset);
+    m_stringLists = reinterpret_cast<const StringRef*>(m_data + m_header->m_stringListsOffset);
+    m_strings = reinterpret_cast<const char16_t*>(m_data + m_header->m_stringsOffset);
+    return true;
+}
+
+void GstStudio::GstMappedCatalog::close() {
+    if (m_data != nullptr) {
+        m_file.unmap(const_cast<uchar*>(m_data));
+    }
+    m_file.close();
+
+    m_data = nullptr;
+    m_size = 0;
+    m_header = nullptr;
+    m_elements = nullptr;
+    m_properties = nullptr;
+    m_pads = nullptr;
+    m_signals = nullptr;
+    m_stringLists = nullptr;
+    m_strings = nullptr;
+}
+
+QByteArray GstStudio::GstMappedCatalog::fingerprint() const {
+    if (!isOpen()) {
+        return {};
+    }
+    return QByteArray(reinterpret_cast<const char*>(m_data + m_header->m_fingerprintOffset),
+                      m_header->m_fingerprintSize);
+}
+
+int GstStudio::GstMappedCatalog::elementCount() const {
+    return isOpen() ? static_cast<int>(m_header->m_elementCount) : 0;
+}
+
+QStringView GstStudio::GstMappedCatalog::elementName(int index) const {
+    return string(m_elements[index].m_name);
+}
+
+QStringView GstStudio::GstMappedCatalog::elementClassification(int index) const {
+    return string(m_elements[index].m_classification);
+}
+
+int GstStudio::GstMappedCatalog::indexOf(QStringView name) const {
+    const ElementRecord* begin = m_elements;
+    const ElementRecord* end = m_elements + elementCount();
+    const ElementRecord* it = std::lower_bound(begin, end, name, [this](const ElementRecord& record, QStringView key) {
+        return string(record.m_name) < key;
+    });
+
+    if (it == end || string(it->m_name) != name) {
+        return -1;
+    }
+    return static_cast<int>(it - begin);
+}
+
+GstElement GstStudio::GstMappedCatalog::elementHeader(int index) const {
+    GstElement element;
+    if (index < 0 || index >= elementCount()) {
+        return element;
+    }
+
+    const ElementRecord& record = m_elements[index];
+    element.m_name = string(record.m_name).toString();
+    element.m_longName = string(record.m_longName).toString();
+    element.m_description = string(record.m_description).toString();
+    element.m_author = string(record.m_author).toString();
+    element.m_classification = string(record.m_classification).toString();
+    element.m_rank = record.m_rank;
+    element.m_pluginName = string(record.m_pluginName).toString();
+    element.m_pluginFilename = string(record.m_pluginFilename).toString();
+    element.m_pluginVersion = string(record.m_pluginVersion).toString();
+    element.m_pluginLicense = string(record.m_pluginLicense).toString();
+    element.m_uriType = static_cast<GstElement::UriType>(record.m_uriType);
+    element.m_uriProtocols = stringList(record.m_firstUriProtocol, record.m_uriProtocolCount);
+
+    const quint32 signalEnd = std::min(record.m_firstSignal + record.m_signalCount, m_header->m_signalCount);
+    for (quint32 i = record.m_firstSignal; i < signalEnd; ++i) {
+        const SignalRecord& signalRecord = m_signals[i];
+        GstSignal descriptor;
+        descriptor.m_name = string(signalRecord.m_name).toString();
+        descriptor.m_kind = static_cast<GstSignal::Kind>(signalRecord.m_kind);
+        descriptor.m_returnType = string(signalRecord.m_returnType).toString();
+        descriptor.m_argumentTypes = stringList(signalRecord.m_firstArgumentType, signalRecord.m_argumentTypeCount);
+        element.m_signals.append(descriptor);
+    }
+
+    return element;
+}
+
+GstElement GstStudio::GstMappedCatalog::element(int index) const {
+    GstElement element = elementHeader(index);
+    if (index < 0 || index >= elementCount()) {
+        return element;
+    }
+
+    const ElementRecord& record = m_elements[index];
+    const quint32 propertyEnd = std::min(record.m_firstProperty + record.m_propertyCount, m_header->m_propertyCount);
+    element.m_properties.reserve(propertyEnd - std::min(record.m_firstProperty, propertyEnd));
+    for (quint32 i = record.m_firstProperty; i < propertyEnd; ++i) {
+        const PropertyRecord& propertyRecord = m_properties[i];
+        GstProperty property;
+        property.m_name = string(propertyRecord.m_name).toString();
+        property.m_type = string(propertyRecord.m_type).toString();
+        property.m_description = string(propertyRecord.m_description).toString();
+        property.m_defaultValue = string(propertyRecord.m_defaultValue).toString();
+        property.m_range = string(propertyRecord.m_range).toString();
+        property.m_flags = GstProperty::Flags::fromInt(static_cast<int>(propertyRecord.m_flags));
+        property.m_enumValues = stringList(propertyRecord.m_firstEnumValue, propertyRecord.m_enumValueCount);
+        element.m_properties.append(property);
+    }
+
+    const quint32 padEnd = std::min(record.m_firstPad + record.m_padCount, m_header->m_padCount);
+    for (quint32 i = record.m_firstPad; i < padEnd; ++i) {
+        const PadRecord& padRecord = m_pads[i];
+        GstPadTemplate pad;
+        pad.m_name = string(padRecord.m_name).toString();
+        pad.m_direction = static_cast<GstPadTemplate::Direction>(padRecord.m_direction);
+        pad.m_presence = static_cast<GstPadTemplate::Presence>(padRecord.m_presence);
+        pad.m_caps = string(padRecord.m_caps).toString();
+        element.m_padTemplates.append(pad);
+    }
+
+    return element;
+}
+
+QStringList GstStudio::GstMappedCatalog::elementNames() const {
+    QStringList names;
+    names.reserve(elementCount());
+    for (int i = 0; i < elementCount(); ++i) {
+        names.append(elementName(i).toString());
+    }
+    return names;
+}
+
+QStringList GstStudio::GstMappedCatalog::elementsByClassification(QStringView classification) const {
+    // The string table stores each classification once; test every distinct one only once
+    QHash<quint32, bool> matches;
+    QStringList names;
+    for (int i = 0; i < elementCount(); ++i) {
+        const StringRef& klass = m_elements[i].m_classification;
+        auto match = matches.constFind(klass.m_offset);
+        if (match == matches.constEnd()) {
+            match = matches.insert(klass.m_offset, string(klass).contains(classification, Qt::CaseInsensitive));
+        }
+        if (match.value()) {
+            names.append(elementName(i).toString());
+        }
+    }
+    return names;
+}
+
+QStringView GstStudio::GstMappedCatalog::string(const StringRef& ref) const {
+    if (static_cast<quint64>(ref.m_offset) + ref.m_length > m_header->m_stringsLength) {
+        return {};
+    }
+    return QStringView(m_strings + ref.m_offset, ref.m_length);
+}
+
+QStringList GstStudio::GstMappedCatalog::stringList(quint32 first, quint32 count) const {
+    QStringList strings;
+    const quint32 end = static_cast<quint32>(std::min<quint64>(quint64(first) + count, m_header->m_stringListCount));
+    for (quint32 i = first; i < end; ++i) {
+        strings.append(string(m_stringLists[i]).toString());
+    }
+    return strings;
+}
+
+bool GstStudio::GstMappedCatalog::validate() const {
+    const Header& header = *m_header;
+    if (header.m_magic != kCatalogMagic || header.m_version != kCatalogVersion) {
+        return false;
+    }
+
+    return static_cast<quint64>(header.m_fingerprintOffset) + header.m_fingerprintSize <=
+               static_cast<quint64>(m_size) &&
+           inBounds(m_size, header.m_elementsOffset, header.m_elementCount, sizeof(ElementRecord)) &&
+           inBounds(m_size, header.m_propertiesOffset, header.m_propertyCount, sizeof(PropertyRecord)) &&
+           inBounds(m_size, header.m_padsOffset, header.m_padCount, sizeof(PadRecord)) &&
+           inBounds(m_size, header.m_signalsOffset, header.m_signalCount, sizeof(SignalRecord)) &&
+           inBounds(m_size, header.m_stringListsOffset, header.m_stringListCount, sizeof(StringRef)) &&
+           inBounds(m_size, header.m_stringsOffset, header.m_stringsLength, sizeof(char16_t));
+}
+
+bool GstStudio::GstMappedCatalog::write(const QString& path, const QByteArray& fingerprint,
+                                        const QMap<QString, GstElement>& elements) {
+    StringTableBuilder strings;
+    QList<ElementRecord> elementRecords;
+    QList<PropertyRecord> propertyRecords;
+    QList<PadRecord> padRecords;
+    QList<SignalRecord> signalRecords;
+    QList<StringRef> stringLists;
+    elementRecords.reserve(elements.size());
+
+    // Appends a list to the string list table and returns the index of its first entry
+    const auto addStringList = [&strings, &stringLists](const QStringList& list) {
+        const auto first = static_cast<quint32>(stringLists.size());
+        for (const QString& text : list) {
+            stringLists.append(strings.add<StringRef>(text));
+        }
+        return first;
+    };
+
+    // QMap iterates in key order, which keeps the element records sorted for indexOf()
+    for (const GstElement& element : elements) {
+        ElementRecord record{};
+        record.m_name = strings.add<StringRef>(element.m_name);
+        record.m_longName = strings.add<StringRef>(element.m_longName);
+        record.m_description = strings.add<StringRef>(element.m_description);
+        record.m_author = strings.add<StringRef>(element.m_author);
+        record.m_classification = strings.add<StringRef>(element.m_classification);
+        record.m_rank = element.m_rank;
+        record.m_pluginName = strings.add<StringRef>(element.m_pluginName);
+        record.m_pluginFilename = strings.add<StringRef>(element.m_pluginFilename);
+        record.m_pluginVersion = strings.add<StringRef>(element.m_pluginVersion);
+        record.m_pluginLicense = strings.add<StringRef>(element.m_pluginLicense);
+        record.m_uriType = static_cast<quint32>(element.m_uriType);
+        record.m_firstUriProtocol = addStringList(element.m_uriProtocols);
+        record.m_uriProtocolCount = static_cast<quint32>(element.m_uriProtocols.size());
+        record.m_firstSignal = static_cast<quint32>(signalRecords.size());
+        record.m_signalCount = static_cast<quint32>(element.m_signals.size());
+        record.m_firstProperty = static_cast<quint32>(propertyRecords.size());
+        record.m_propertyCount = static_cast<quint32>(element.m_properties.size());
+        record.m_firstPad = static_cast<quint32>(padRecords.size());
+        record.m_padCount = static_cast<quint32>(element.m_padTemplates.size());
+
+        for (const GstProperty& property : element.m_properties) {
+            PropertyRecord propertyRecord{};
+            propertyRecord.m_name = strings.add<StringRef>(property.m_name);
+            propertyRecord.m_type = strings.add<StringRef>(property.m_type);
+            propertyRecord.m_description = strings.add<StringRef>(property.m_description);
+            propertyRecord.m_defaultValue = strings.add<StringRef>(property.m_defaultValue);
+            propertyRecord.m_range = strings.add<StringRef>(property.m_range);
+            propertyRecord.m_firstEnumValue = addStringList(property.m_enumValues);
+            propertyRecord.m_enumValueCount = static_cast<quint32>(property.m_enumValues.size());
+            propertyRecord.m_flags = static_cast<quint32>(property.m_flags.toInt());
+            propertyRecords.append(propertyRecord);
+        }
+
+        for (const GstPadTemplate& pad : element.m_padTemplates) {
+            PadRecord padRecord{};
+            padRecord.m_name = strings.add<StringRef>(pad.m_name);
+            padRecord.m_direction = static_cast<quint8>(pad.m_direction);
+            padRecord.m_presence = static_cast<quint8>(pad.m_presence);
+            padRecord.m_caps = strings.add<StringRef>(pad.m_caps);
+            padRecords.append(padRecord);
+        }
+
+        for (const GstSignal& descriptor : element.m_signals) {
+            SignalRecord signalRecord{};
+            signalRecord.m_name = strings.add<StringRef>(descriptor.m_name);
+            signalRecord.m_returnType = strings.add<StringRef>(descriptor.m_returnType);
+            signalRecord.m_firstArgumentType = addStringList(descriptor.m_argumentTypes);
+            signalRecord.m_argumentTypeCount = static_cast<quint32>(descriptor.m_argumentTypes.size());
+            signalRecord.m_kind = static_cast<quint8>(descriptor.m_kind);
+            signalRecords.append(signalRecord);
+        }
+
+        elementRecords.append(record);
+    }
+
+    Header header{};
+    header.m_magic = kCatalogMagic;
+    header.m_version = kCatalogVersion;
+
+    QByteArray data(sizeof(Header), '\0');
+    header.m_fingerprintOffset = static_cast<quint32>(data.size());
+    header.m_fingerprintSize = static_cast<quint32>(fingerprint.size());
+    data.append(fingerprint);
+    alignTo4(data);
+
+    header.m_elementsOffset = static_cast<quint32>(data.size());
+    header.m_elementCount = static_cast<quint32>(elementRecords.size());
+    appendRecords(data, elementRecords);
+
+    header.m_propertiesOffset = static_cast<quint32>(data.size());
+    header.m_propertyCount = static_cast<quint32>(propertyRecords.size());
+    appendRecords(data, propertyRecords);
+
+    header.m_padsOffset = static_cast<quint32>(data.size());
+    header.m_padCount = static_cast<quint32>(padRecords.size());
+    appendRecords(data, padRecords);
+
+    header.m_signalsOffset = static_cast<quint32>(data.size());
+    header.m_signalCount = static_cast<quint32>(signalRecords.size());
+    appendRecords(data, signalRecords);
+
+    header.m_stringListsOffset = static_cast<quint32>(data.size());
+    header.m_stringListCount = static_cast<quint32>(stringLists.size());
+    appendRecords(data, stringLists);
+
+    header.m_stringsOffset = static_cast<quint32>(data.size());
+    header.m_stringsLength = static_cast<quint32>(strings.pool().size());
+    data.append(reinterpret_cast<const char*>(strings.pool().utf16()), strings.pool().size() * 2);
+
+    std::memcpy(data.data(), &header, sizeof(Header));
+
+    if (!QDir().mkpath(QFileInfo(path).absolutePath())) {
+        return false;
+    }
+
+    // QSaveFile keeps a previous catalog intact if writing fails halfway
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size()) {
+        return false;
+    }
+    return file.commit();
+}
+
+} // namespace GstStudio
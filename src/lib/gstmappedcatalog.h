@@ -0,0 +1,168 @@
+/**
+ * @file gstmappedcatalog.h
+ * @brief Memory-mapped, read-only element catalog
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QByteArray>
+#include <QFile>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @class GstMappedCatalog
+ * @brief Memory-mapped, read-only element catalog
+ *
+ * The catalog file consists of a header, fixed-size element, property, pad
+ * template and signal records and a deduplicated UTF-16 string table. Records refer
+ * to strings and to each other by offset, so the file is used in place:
+ * opening it costs the same regardless of catalog size, and lookups return
+ * QStringViews into the mapping. Only elements requested through element()
+ * are materialized as GstElement.
+ */
+class GstMappedCatalog {
+  public:
+    GstMappedCatalog() = default;
+    ~GstMappedCatalog();
+
+    GstMappedCatalog(const GstMappedCatalog&) = delete;
+    GstMappedCatalog& operator=(const GstMappedCatalog&) = delete;
+
+    /**
+     * @brief Map a catalog file
+     * @param path Catalog file path
+     * @return true if the file was mapped and passed validation
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief Unmap the catalog file
+     */
+    void close();
+
+    /**
+     * @brief Check whether a catalog is mapped
+     * @return true if open() succeeded and close() was not called since
+     */
+    [[nodiscard]] bool isOpen() const {
+        return m_data != nullptr;
+    }
+
+    /**
+     * @brief Get the plugin fingerprint the catalog was written with
+     * @return Fingerprint bytes
+     */
+    [[nodiscard]] QByteArray fingerprint() const;
+
+    /**
+     * @brief Get number of elements in the catalog
+     * @return Element count
+     */
+    [[nodiscard]] int elementCount() const;
+
+    /**
+     * @brief Get the name of an element without materializing it
+     * @param index Element index, elements are sorted by name
+     * @return View into the mapped string table
+     */
+    [[nodiscard]] QStringView elementName(int index) const;
+
+    /**
+     * @brief Get the classification of an element without materializing it
+     * @param index Element index
+     * @return View into the mapped string table
+     */
+    [[nodiscard]] QStringView elementClassification(int index) const;
+
+    /**
+     * @brief Find an element by name
+     * @param name Element name
+     * @return Element index, or -1 if not found
+     */
+    [[nodiscard]] int indexOf(QStringView name) const;
+
+    /**
+     * @brief Materialize the factory details, plugin details and signals of a single element
+     * @param index Element index
+     * @return Element without properties and pad templates
+     */
+    [[nodiscard]] GstElement elementHeader(int index) const;
+
+    /**
+     * @brief Materialize a single element
+     * @param index Element index
+     * @return Fully populated element
+     */
+    [[nodiscard]] GstElement element(int index) const;
+
+    /**
+     * @brief Get names of all elements
+     * @return Sorted element names
+     */
+    [[nodiscard]] QStringList elementNames() const;
+
+    /**
+     * @brief Get names of elements whose classification contains a string
+     * @param classification Case-insensitive classification filter
+     * @return Sorted element names
+     */
+    [[nodiscard]] QStringList elementsByClassification(QStringView classification) const;
+
+    /**
+     * @brief Write a catalog file
+     * @param path Catalog file path
+     * @param fingerprint Plugin fingerprint to store
+     * @param elements Elements to store
+     * @return true if the file was written
+     */
+    static bool write(const QString& path, const QByteArray& fingerprint, const QMap<QString, GstElement>& elements);
+
+  private:
+    struct StringRef;
+    struct Header;
+    struct ElementRecord;
+    struct PropertyRecord;
+    struct PadRecord;
+    struct SignalRecord;
+
+    QFile m_file;                                 ///< Backing file, kept open while mapped
+    const uchar* m_data = nullptr;                ///< Start of the mapping
+    qint64 m_size = 0;                            ///< Size of the mapping in bytes
+    const Header* m_header = nullptr;             ///< Validated file header
+    const ElementRecord* m_elements = nullptr;    ///< Element records sorted by name
+    const PropertyRecord* m_properties = nullptr; ///< Property records grouped by element
+    const PadRecord* m_pads = nullptr;            ///< Pad template records grouped by element
+    const SignalRecord* m_signals = nullptr;      ///< Signal records grouped by element
+    const StringRef* m_stringLists = nullptr;     ///< Enum values, URI protocols and argument types, grouped
+    const char16_t* m_strings = nullptr;          ///< UTF-16 string table
+
+    /**
+     * @brief Resolve a string reference
+     * @param ref Reference into the string table
+     * @return View into the mapping
+     */
+    [[nodiscard]] QStringView string(const StringRef& ref) const;
+
+    /**
+     * @brief Resolve a range of the string list table
+     * @param first Index of the first entry
+     * @param count Number of entries
+     * @return Strings, clipped to the table
+     */
+    [[nodiscard]] QStringList stringList(quint32 first, quint32 count) const;
+
+    /**
+     * @brief Check that all offsets in the mapping are within bounds
+     * @return true if the catalog can be read safely
+     */
+    [[nodiscard]] bool validate() const;
+};
+
+} // namespace GstStudio
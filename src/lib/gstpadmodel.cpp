@@ -20,9 +20,9 @@ QVariant GstStudio::GstPadModel::data(const QModelIndex& index, int role) const
         case NAME_ROLE:
             return pad.m_name;
         case DIRECTION_ROLE:
-            return pad.m_direction;
+            return GstPadTemplate::directionName(pad.m_direction);
         case PRESENCE_ROLE:
-            return pad.m_presence;
+            return GstPadTemplate::presenceName(pad.m_presence);
         case CAPS_ROLE:
             return pad.m_caps;
         default:
@@ -40,9 +40,8 @@ QHash<int, QByteArray> GstStudio::GstPadModel::roleNames() const {
 }
 
 void GstStudio::GstPadModel::setPadTemplates(const QList<GstPadTemplate>& pads) {
-    beginResetModel();
-    m_pads = pads;
-    endResetModel();
+    // Pad templates both elements have in common, e.g. "src" and "sink", keep their rows
+    applyKeyedDiff(*this, m_pads, pads);
 }
 
 } // namespace GstStudio
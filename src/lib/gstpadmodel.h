@@ -7,6 +7,7 @@
 #pragma once
 
 #include "gstelement.h"
+#include "gstlistdiff.h"
 #include <QAbstractListModel>
 #include <QQmlEngine>
 
@@ -64,11 +65,18 @@ class GstPadModel : public QAbstractListModel {
 
     /**
      * @brief Set pad templates to display
+     *
+     * Rows are matched by pad template name and only changed rows are
+     * notified; the list is shared with the caller, not copied.
+     *
      * @param pads List of pad templates
      */
     void setPadTemplates(const QList<GstPadTemplate>& pads);
 
   private:
+    template <typename Model, typename T>
+    friend void applyKeyedDiff(Model& model, QList<T>& items, const QList<T>& target);
+
     QList<GstPadTemplate> m_pads; ///< List of pad templates
 };
 
@@ -0,0 +1,153 @@
+#include "gstpropertyindex.h"
+#include <QStringTokenizer>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace GstStudio {
+
+namespace {
+
+/// Flags by the name a query refers to them with
+constexpr std::pair<GstProperty::Flag, QStringView> kFlagNames[] = {{GstProperty::Readable, u"readable"},
+                                                                    {GstProperty::Writable, u"writable"},
+                                                                    {GstProperty::Controllable, u"controllable"}};
+
+QList<quint64> intersect(const QList<quint64>& first, const QList<quint64>& second) {
+    QList<quint64> result;
+    result.reserve(std::min(first.size(), second.size()));
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(result));
+    return result;
+}
+
+int elementOf(quint64 posting) {
+    return static_cast<int>(posting >> 32);
+}
+
+int propertyOf(quint64 posting) {
+    return static_cast<int>(posting & 0xffffffffU);
+}
+
+} // namespace
+
+void GstStudio::GstPropertyIndex::clear() {
+    m_elementNames.clear();
+    m_properties.clear();
+    m_names = Field();
+    m_types = Field();
+    m_flags = Field();
+}
+
+void GstStudio::GstPropertyIndex::build(const QList<GstElement>& elements) {
+    clear();
+
+    QList<const GstElement*> sorted;
+    sorted.reserve(elements.size());
+    for (const GstElement& element : elements) {
+        sorted.append(&element);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const GstElement* a, const GstElement* b) { return a->m_name < b->m_name; });
+
+    // Ids and property indices only grow, so every posting list is appended to in ascending order
+    m_elementNames.reserve(sorted.size());
+    m_properties.reserve(sorted.size());
+    for (int id = 0; id < sorted.size(); ++id) {
+        const GstElement& element = *sorted.at(id);
+        QStringList propertyNames;
+        propertyNames.reserve(element.m_properties.size());
+        for (int i = 0; i < element.m_properties.size(); ++i) {
+            const GstProperty& property = element.m_properties.at(i);
+            const quint64 entry = posting(id, i);
+            m_names.m_postings[property.m_name.toCaseFolded()].append(entry);
+            m_types.m_postings[property.m_type.toCaseFolded()].append(entry);
+            for (const auto& [flag, name] : kFlagNames) {
+                if (property.m_flags.testFlag(flag)) {
+                    m_flags.m_postings[name.toString()].append(entry);
+                }
+            }
+            propertyNames.append(property.m_name);
+        }
+        m_elementNames.append(element.m_name);
+        m_properties.append(propertyNames);
+    }
+
+    for (Field* field : {&m_names, &m_types, &m_flags}) {
+        field->m_values = field->m_postings.keys();
+        std::sort(field->m_values.begin(), field->m_values.end());
+    }
+}
+
+QStringList GstStudio::GstPropertyIndex::search(const QString& query) const {
+    QStringList names;
+    int previous = -1;
+    for (quint64 entry : matches(query)) {
+        // Postings are ordered by element, so the properties of one element are adjacent
+        const int element = elementOf(entry);
+        if (element != previous) {
+            names.append(m_elementNames.at(element));
+            previous = element;
+        }
+    }
+    return names;
+}
+
+QMap<QString, QStringList> GstStudio::GstPropertyIndex::matchingProperties(const QString& query) const {
+    QMap<QString, QStringList> properties;
+    auto current = properties.end();
+    int previous = -1;
+    for (quint64 entry : matches(query)) {
+        // Element ids follow the sorted names, so every element is appended at the end of the map
+        const int element = elementOf(entry);
+        if (element != previous) {
+            current = properties.insert(properties.end(), m_elementNames.at(element), QStringList());
+            previous = element;
+        }
+        current->append(m_properties.at(element).at(propertyOf(entry)));
+    }
+    return properties;
+}
+
+QList<quint64> GstStudio::GstPropertyIndex::matches(const QString& query) const {
+    const QString folded = query.toCaseFolded().simplified();
+    QList<quint64> result;
+    bool first = true;
+    for (QStringView term : qTokenize(folded, u' ')) {
+        QList<quint64> postings;
+        if (term.startsWith(u"type:")) {
+            postings = prefixMatches(m_types, term.sliced(5));
+        } else if (term.startsWith(u"flag:")) {
+            postings = prefixMatches(m_flags, term.sliced(5));
+        } else if (term.startsWith(u"name:")) {
+            postings = prefixMatches(m_names, term.sliced(5));
+        } else {
+            postings = prefixMatches(m_names, term);
+        }
+
+        result = first ? postings : intersect(result, postings);
+        first = false;
+        if (result.isEmpty()) {
+            break;
+        }
+    }
+    return result;
+}
+
+QList<quint64> GstStudio::GstPropertyIndex::prefixMatches(const Field& field, QStringView prefix) {
+    QList<quint64> result;
+    int matchedValues = 0;
+    for (auto it = std::lower_bound(field.m_values.begin(), field.m_values.end(), prefix);
+         it != field.m_values.end() && it->startsWith(prefix); ++it) {
+        result += field.m_postings.value(*it);
+        ++matchedValues;
+    }
+
+    // Lists of several values interleave, and flag lists share properties; a single list is already in order
+    if (matchedValues > 1) {
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+    }
+    return result;
+}
+
+} // namespace GstStudio
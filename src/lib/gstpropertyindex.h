@@ -0,0 +1,119 @@
+/**
+ * @file gstpropertyindex.h
+ * @brief Inverted index over the properties of all elements
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @class GstPropertyIndex
+ * @brief Inverted index over the properties of all elements
+ *
+ * Answers questions such as "which elements have a latency property" or
+ * "which elements have a controllable boolean property" without visiting
+ * every element. Property names, type names and flags are case-folded and
+ * map to posting lists of (element, property) pairs, so terms of a query
+ * must all match the same property.
+ *
+ * A query is split at whitespace into terms:
+ * - "type:<prefix>" matches the property type, e.g. "type:unsigned"
+ * - "flag:<prefix>" matches a flag: readable, writable or controllable
+ * - "name:<prefix>" or a bare term matches the property name
+ *
+ * Every term is a case-insensitive prefix; distinct values are kept
+ * sorted, so a prefix costs a binary search plus one posting list per
+ * matching value.
+ */
+class GstPropertyIndex {
+  public:
+    /**
+     * @brief Remove all elements
+     */
+    void clear();
+
+    /**
+     * @brief Index the properties of a set of elements, replacing the current index
+     * @param elements Elements with their properties
+     */
+    void build(const QList<GstElement>& elements);
+
+    /**
+     * @brief Check whether any element has been indexed
+     * @return true if no elements are known
+     */
+    [[nodiscard]] bool isEmpty() const {
+        return m_elementNames.isEmpty();
+    }
+
+    /**
+     * @brief Find elements with a property matching all terms of a query
+     * @param query Whitespace-separated terms, see the class description
+     * @return Element names sorted alphabetically, empty for an empty query
+     */
+    [[nodiscard]] QStringList search(const QString& query) const;
+
+    /**
+     * @brief Find the properties matching all terms of a query, grouped by element
+     *
+     * Resolves the query once for all elements, for views listing what
+     * matched next to every element of the search() result.
+     *
+     * @param query Whitespace-separated terms, see the class description
+     * @return Element name to its matching property names in element order
+     */
+    [[nodiscard]] QMap<QString, QStringList> matchingProperties(const QString& query) const;
+
+  private:
+    /**
+     * @struct Field
+     * @brief Postings of one indexed property field
+     */
+    struct Field {
+        QHash<QString, QList<quint64>> m_postings; ///< Case-folded value to ascending postings
+        QStringList m_values;                      ///< Case-folded values, sorted for prefix lookups
+    };
+
+    QStringList m_elementNames;      ///< Element names by id, sorted
+    QList<QStringList> m_properties; ///< Property names by element id, in element order
+    Field m_names;                   ///< Property names
+    Field m_types;                   ///< Property type names
+    Field m_flags;                   ///< Names of the flags set on a property
+
+    /**
+     * @brief Get the postings of the properties matching all terms of a query
+     * @param query Whitespace-separated terms
+     * @return Ascending postings, see posting()
+     */
+    [[nodiscard]] QList<quint64> matches(const QString& query) const;
+
+    /**
+     * @brief Get the postings of all values of a field starting with a prefix
+     * @param field Indexed field
+     * @param prefix Case-folded prefix
+     * @return Ascending postings
+     */
+    static QList<quint64> prefixMatches(const Field& field, QStringView prefix);
+
+    /**
+     * @brief Pack an element and one of its properties into a posting
+     * @param element Element id
+     * @param property Index of the property within the element
+     * @return Posting ordered by element, then property
+     */
+    static quint64 posting(int element, int property) {
+        return (static_cast<quint64>(element) << 32) | static_cast<quint32>(property);
+    }
+};
+
+} // namespace GstStudio
@@ -30,9 +30,9 @@ QVariant GstStudio::GstPropertyModel::data(const QModelIndex& index, int role) c
         case EnumValuesRole:
             return QVariant::fromValue(prop.m_enumValues);
         case WritableRole:
-            return prop.m_writable;
+            return prop.isWritable();
         case ReadableRole:
-            return prop.m_readable;
+            return prop.isReadable();
         default:
             return {};
     }
@@ -52,9 +52,8 @@ QHash<int, QByteArray> GstStudio::GstPropertyModel::roleNames() const {
 }
 
 void GstStudio::GstPropertyModel::setProperties(const QList<GstProperty>& properties) {
-    beginResetModel();
-    m_properties = properties;
-    endResetModel();
+    // Properties inherited from common base classes, e.g. "name", keep their rows
+    applyKeyedDiff(*this, m_properties, properties);
 }
 
 } // namespace GstStudio
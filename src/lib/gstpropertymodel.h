@@ -7,6 +7,7 @@
 #pragma once
 
 #include "gstelement.h"
+#include "gstlistdiff.h"
 #include <QAbstractListModel>
 #include <QQmlEngine>
 
@@ -68,11 +69,18 @@ class GstPropertyModel : public QAbstractListModel {
 
     /**
      * @brief Set properties to display
+     *
+     * Rows are matched by property name and only changed rows are notified;
+     * the list is shared with the caller, not copied.
+     *
      * @param properties List of properties
      */
     void setProperties(const QList<GstProperty>& properties);
 
   private:
+    template <typename Model, typename T>
+    friend void applyKeyedDiff(Model& model, QList<T>& items, const QList<T>& target);
+
     QList<GstProperty> m_properties; ///< List of properties
 };
 
@@ -0,0 +1,370 @@
+#include "gstregistrybackend.h"
+#include <algorithm>
+#include <gst/gst.h>
+
+// GStreamer declares its own GstElement and GstPadTemplate at global scope; inside
+// namespace GstStudio the unqualified names below refer to the catalog structs.
+namespace GstStudio {
+
+namespace {
+
+QString fromUtf8(const gchar* text) {
+    return text != nullptr ? QString::fromUtf8(text) : QString();
+}
+
+/// Type names as printed by gst-inspect-1.0, e.g. "Unsigned Integer" or "Enum \"GstFoo\""
+QString typeName(const GParamSpec* spec) {
+    const GType type = spec->value_type;
+    switch (G_TYPE_FUNDAMENTAL(type)) {
+        case G_TYPE_STRING:
+            return "String";
+        case G_TYPE_BOOLEAN:
+            return "Boolean";
+        case G_TYPE_INT:
+            return "Integer";
+        case G_TYPE_UINT:
+            return "Unsigned Integer";
+        case G_TYPE_LONG:
+            return "Long";
+        case G_TYPE_ULONG:
+            return "Unsigned Long";
+        case G_TYPE_INT64:
+            return "Integer64";
+        case G_TYPE_UINT64:
+            return "Unsigned Integer64";
+        case G_TYPE_FLOAT:
+            return "Float";
+        case G_TYPE_DOUBLE:
+            return "Double";
+        case G_TYPE_ENUM:
+            return QString("Enum \"%1\"").arg(fromUtf8(g_type_name(type)));
+        case G_TYPE_FLAGS:
+            return QString("Flags \"%1\"").arg(fromUtf8(g_type_name(type)));
+        case G_TYPE_BOXED:
+            return QString("Boxed pointer of type \"%1\"").arg(fromUtf8(g_type_name(type)));
+        case G_TYPE_OBJECT:
+            return QString("Object of type \"%1\"").arg(fromUtf8(g_type_name(type)));
+        default:
+            return fromUtf8(g_type_name(type));
+    }
+}
+
+QString rangeText(const GParamSpec* spec) {
+    if (G_IS_PARAM_SPEC_INT(spec)) {
+        const auto* s = G_PARAM_SPEC_INT(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_UINT(spec)) {
+        const auto* s = G_PARAM_SPEC_UINT(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_LONG(spec)) {
+        const auto* s = G_PARAM_SPEC_LONG(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_ULONG(spec)) {
+        const auto* s = G_PARAM_SPEC_ULONG(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_INT64(spec)) {
+        const auto* s = G_PARAM_SPEC_INT64(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_UINT64(spec)) {
+        const auto* s = G_PARAM_SPEC_UINT64(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_FLOAT(spec)) {
+        const auto* s = G_PARAM_SPEC_FLOAT(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    if (G_IS_PARAM_SPEC_DOUBLE(spec)) {
+        const auto* s = G_PARAM_SPEC_DOUBLE(spec);
+        return QString("%1 - %2").arg(s->minimum).arg(s->maximum);
+    }
+    return {};
+}
+
+QString defaultValueText(GParamSpec* spec) {
+    const GValue* value = g_param_spec_get_default_value(spec);
+    if (G_VALUE_HOLDS_ENUM(value)) {
+        // gst-inspect-1.0 shows enum defaults as 'value, "nick"'
+        auto* enumClass = static_cast<GEnumClass*>(g_type_class_ref(spec->value_type));
+        const GEnumValue* enumValue = g_enum_get_value(enumClass, g_value_get_enum(value));
+        QString text = QString::number(g_value_get_enum(value));
+        if (enumValue != nullptr) {
+            text += QString(", \"%1\"").arg(fromUtf8(enumValue->value_nick));
+        }
+        g_type_class_unref(enumClass);
+        return text;
+    }
+
+    gchar* contents = g_strdup_value_contents(value);
+    QString text = fromUtf8(contents);
+    g_free(contents);
+    return text;
+}
+
+QStringList enumValues(const GParamSpec* spec) {
+    QStringList values;
+    if (!G_IS_PARAM_SPEC_ENUM(spec)) {
+        return values;
+    }
+
+    auto* enumClass = static_cast<GEnumClass*>(g_type_class_ref(spec->value_type));
+    for (guint i = 0; i < enumClass->n_values; ++i) {
+        values.append(fromUtf8(enumClass->values[i].value_nick));
+    }
+    g_type_class_unref(enumClass);
+    return values;
+}
+
+GstProperty property(GParamSpec* spec) {
+    GstProperty property;
+    property.m_name = fromUtf8(g_param_spec_get_name(spec));
+    property.m_type = typeName(spec);
+    property.m_description = fromUtf8(g_param_spec_get_blurb(spec));
+    property.m_range = rangeText(spec);
+    property.m_enumValues = enumValues(spec);
+    property.m_flags.setFlag(GstProperty::Readable, (spec->flags & G_PARAM_READABLE) != 0);
+    property.m_flags.setFlag(GstProperty::Writable, (spec->flags & G_PARAM_WRITABLE) != 0);
+    property.m_flags.setFlag(GstProperty::Controllable, (spec->flags & GST_PARAM_CONTROLLABLE) != 0);
+    if (property.isReadable()) {
+        property.m_defaultValue = defaultValueText(spec);
+    }
+    return property;
+}
+
+/// Caps in the layout printed by gst-inspect-1.0: one line per structure name, one per field
+QString capsText(GstStaticCaps* staticCaps) {
+    GstCaps* caps = gst_static_caps_get(staticCaps);
+    if (caps == nullptr) {
+        return {};
+    }
+
+    QStringList lines;
+    if (gst_caps_is_any(caps)) {
+        lines.append("ANY");
+    } else if (gst_caps_is_empty(caps)) {
+        lines.append("EMPTY");
+    }
+
+    const guint structureCount = gst_caps_is_any(caps) ? 0 : gst_caps_get_size(caps);
+    for (guint i = 0; i < structureCount; ++i) {
+        const GstStructure* structure = gst_caps_get_structure(caps, i);
+        GstCapsFeatures* features = gst_caps_get_features(caps, i);
+
+        QString name = fromUtf8(gst_structure_get_name(structure));
+        if (features != nullptr && !gst_caps_features_is_equal(features, GST_CAPS_FEATURES_MEMORY_SYSTEM_MEMORY)) {
+            gchar* featuresText = gst_caps_features_to_string(features);
+            name += QString("(%1)").arg(fromUtf8(featuresText));
+            g_free(featuresText);
+        }
+        lines.append(name);
+
+        for (gint field = 0; field < gst_structure_n_fields(structure); ++field) {
+            const gchar* fieldName = gst_structure_nth_field_name(structure, static_cast<guint>(field));
+            gchar* value = gst_value_serialize(gst_structure_get_value(structure, fieldName));
+            lines.append(QString("%1: %2").arg(fromUtf8(fieldName), fromUtf8(value)));
+            g_free(value);
+        }
+    }
+
+    gst_caps_unref(caps);
+    return lines.join('\n');
+}
+
+GstPadTemplate padTemplate(GstStaticPadTemplate* staticTemplate) {
+    GstPadTemplate pad;
+    pad.m_name = fromUtf8(staticTemplate->name_template);
+
+    switch (staticTemplate->direction) {
+        case GST_PAD_SRC:
+            pad.m_direction = GstPadTemplate::Direction::Src;
+            break;
+        case GST_PAD_SINK:
+            pad.m_direction = GstPadTemplate::Direction::Sink;
+            break;
+        default:
+            break;
+    }
+
+    switch (staticTemplate->presence) {
+        case GST_PAD_ALWAYS:
+            pad.m_presence = GstPadTemplate::Presence::Always;
+            break;
+        case GST_PAD_SOMETIMES:
+            pad.m_presence = GstPadTemplate::Presence::Sometimes;
+            break;
+        case GST_PAD_REQUEST:
+            pad.m_presence = GstPadTemplate::Presence::Request;
+            break;
+    }
+
+    pad.m_caps = capsText(&staticTemplate->static_caps);
+    return pad;
+}
+
+/// Type name as gst-inspect-1.0 prints it, with a '*' after pointer, boxed and object types
+QString signalTypeName(GType type) {
+    type &= ~G_SIGNAL_TYPE_STATIC_SCOPE;
+    const QString name = fromUtf8(g_type_name(type));
+    if (type != G_TYPE_POINTER &&
+        (G_TYPE_FUNDAMENTAL(type) == G_TYPE_POINTER || G_TYPE_IS_BOXED(type) || G_TYPE_IS_OBJECT(type))) {
+        return name + u'*';
+    }
+    return name;
+}
+
+GstSignal signalDescriptor(guint signalId) {
+    GSignalQuery query;
+    g_signal_query(signalId, &query);
+
+    GstSignal descriptor;
+    descriptor.m_name = fromUtf8(query.signal_name);
+    descriptor.m_kind = (query.signal_flags & G_SIGNAL_ACTION) != 0 ? GstSignal::Kind::Action : GstSignal::Kind::Signal;
+    descriptor.m_returnType = signalTypeName(query.return_type);
+    for (guint i = 0; i < query.n_params; ++i) {
+        descriptor.m_argumentTypes.append(signalTypeName(query.param_types[i]));
+    }
+    return descriptor;
+}
+
+/// Signals and actions in the order gst-inspect-1.0 lists them
+void listSignals(GType elementType, GstElement& element) {
+    QList<GstSignal> emitted;
+    QList<GstSignal> actions;
+
+    // Elements with sometimes pads list the GstElement signals needed to use them first
+    const bool hasSometimesPads =
+        std::any_of(element.m_padTemplates.cbegin(), element.m_padTemplates.cend(), [](const GstPadTemplate& pad) {
+            return pad.m_presence == GstPadTemplate::Presence::Sometimes;
+        });
+    if (hasSometimesPads) {
+        for (const char* name : {"pad-added", "pad-removed", "no-more-pads"}) {
+            emitted.append(signalDescriptor(g_signal_lookup(name, GST_TYPE_ELEMENT)));
+        }
+    }
+
+    // Signals of the GstElement and GstObject base classes are not listed, bin signals only for GstBin itself
+    for (GType type = elementType; type != 0; type = g_type_parent(type)) {
+        if (type == GST_TYPE_ELEMENT || type == GST_TYPE_OBJECT) {
+            break;
+        }
+        if (type == GST_TYPE_BIN && elementType != GST_TYPE_BIN) {
+            continue;
+        }
+
+        guint count = 0;
+        guint* ids = g_signal_list_ids(type, &count);
+        for (guint i = 0; i < count; ++i) {
+            const GstSignal descriptor = signalDescriptor(ids[i]);
+            (descriptor.m_kind == GstSignal::Kind::Action ? actions : emitted).append(descriptor);
+        }
+        g_free(ids);
+    }
+
+    element.m_signals = emitted + actions;
+}
+
+} // namespace
+
+bool GstStudio::GstRegistryBackend::initialize(QString* errorMessage) {
+    GError* error = nullptr;
+    if (gst_init_check(nullptr, nullptr, &error)) {
+        return true;
+    }
+
+    if (errorMessage != nullptr) {
+        *errorMessage = fromUtf8(error != nullptr ? error->message : "gst_init_check() failed");
+    }
+    g_clear_error(&error);
+    return false;
+}
+
+QStringList GstStudio::GstRegistryBackend::elementNames(QString* errorMessage) {
+    if (!initialize(errorMessage)) {
+        return {};
+    }
+
+    QStringList names;
+    GList* features = gst_registry_get_feature_list(gst_registry_get(), GST_TYPE_ELEMENT_FACTORY);
+    for (GList* it = features; it != nullptr; it = it->next) {
+        names.append(fromUtf8(gst_plugin_feature_get_name(GST_PLUGIN_FEATURE(it->data))));
+    }
+    gst_plugin_feature_list_free(features);
+
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+GstElement GstStudio::GstRegistryBackend::element(const QString& elementName) {
+    GstElement element;
+    element.m_name = elementName;
+    if (!initialize()) {
+        return element;
+    }
+
+    GstElementFactory* factory = gst_element_factory_find(elementName.toUtf8().constData());
+    if (factory == nullptr) {
+        return element;
+    }
+
+    element.m_longName = fromUtf8(gst_element_factory_get_metadata(factory, GST_ELEMENT_METADATA_LONGNAME));
+    element.m_classification = fromUtf8(gst_element_factory_get_metadata(factory, GST_ELEMENT_METADATA_KLASS));
+    element.m_description = fromUtf8(gst_element_factory_get_metadata(factory, GST_ELEMENT_METADATA_DESCRIPTION));
+    element.m_author = fromUtf8(gst_element_factory_get_metadata(factory, GST_ELEMENT_METADATA_AUTHOR));
+    element.m_rank = static_cast<int>(gst_plugin_feature_get_rank(GST_PLUGIN_FEATURE(factory)));
+    element.m_pluginName = fromUtf8(gst_plugin_feature_get_plugin_name(GST_PLUGIN_FEATURE(factory)));
+
+    GstPlugin* plugin = gst_plugin_feature_get_plugin(GST_PLUGIN_FEATURE(factory));
+    if (plugin != nullptr) {
+        element.m_pluginFilename = fromUtf8(gst_plugin_get_filename(plugin));
+        element.m_pluginVersion = fromUtf8(gst_plugin_get_version(plugin));
+        element.m_pluginLicense = fromUtf8(gst_plugin_get_license(plugin));
+        gst_object_unref(plugin);
+    }
+
+    switch (gst_element_factory_get_uri_type(factory)) {
+        case GST_URI_SRC:
+            element.m_uriType = GstElement::UriType::Source;
+            break;
+        case GST_URI_SINK:
+            element.m_uriType = GstElement::UriType::Sink;
+            break;
+        default:
+            break;
+    }
+    if (const gchar* const* protocols = gst_element_factory_get_uri_protocols(factory)) {
+        for (; *protocols != nullptr; ++protocols) {
+            element.m_uriProtocols.append(fromUtf8(*protocols));
+        }
+    }
+
+    for (const GList* it = gst_element_factory_get_static_pad_templates(factory); it != nullptr; it = it->next) {
+        element.m_padTemplates.append(padTemplate(static_cast<GstStaticPadTemplate*>(it->data)));
+    }
+
+    // Properties live on the element class; loading the plugin is enough, no instance is created
+    auto* loaded = GST_ELEMENT_FACTORY(gst_plugin_feature_load(GST_PLUGIN_FEATURE(factory)));
+    if (loaded != nullptr) {
+        const GType type = gst_element_factory_get_element_type(loaded);
+        if (type != G_TYPE_INVALID) {
+            gpointer klass = g_type_class_ref(type);
+            guint count = 0;
+            GParamSpec** specs = g_object_class_list_properties(G_OBJECT_CLASS(klass), &count);
+            for (guint i = 0; i < count; ++i) {
+                element.m_properties.append(property(specs[i]));
+            }
+            g_free(specs);
+            listSignals(type, element);
+            g_type_class_unref(klass);
+        }
+        gst_object_unref(loaded);
+    }
+
+    gst_object_unref(factory);
+    return element;
+}
+
+} // namespace GstStudio
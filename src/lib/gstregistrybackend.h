@@ -0,0 +1,51 @@
+/**
+ * @file gstregistrybackend.h
+ * @brief In-process element discovery through the GStreamer registry
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QString>
+#include <QStringList>
+
+namespace GstStudio {
+
+/**
+ * @class GstRegistryBackend
+ * @brief In-process element discovery through the GStreamer registry
+ *
+ * Fills GstElement directly from GstRegistry, GstElementFactory, GParamSpec
+ * and GstStaticPadTemplate instead of scraping gst-inspect-1.0 output, which
+ * avoids the subprocess and any dependency on the output language. Only
+ * built when GSTSTUDIO_REGISTRY_BACKEND is enabled in CMake.
+ */
+class GstRegistryBackend {
+  public:
+    /**
+     * @brief Initialize GStreamer, loading the registry on first use
+     * @param errorMessage Receives the reason if GStreamer could not be initialized
+     * @return true if GStreamer is usable
+     */
+    static bool initialize(QString* errorMessage = nullptr);
+
+    /**
+     * @brief Initialize GStreamer and list all element factories
+     * @param errorMessage Receives the reason if GStreamer could not be initialized
+     * @return Sorted element names, empty on failure
+     */
+    static QStringList elementNames(QString* errorMessage = nullptr);
+
+    /**
+     * @brief Read the complete description of an element factory
+     *
+     * Safe to call from worker threads; initializes GStreamer if needed.
+     *
+     * @param elementName Element factory name
+     * @return Populated element, or an element with only the name set if the factory is unknown
+     */
+    static GstElement element(const QString& elementName);
+};
+
+} // namespace GstStudio
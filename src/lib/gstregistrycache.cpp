@@ -0,0 +1,180 @@
+#include "gstregistrycache.h"
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <algorithm>
+
+namespace GstStudio {
+
+namespace {
+
+constexpr quint32 kSnapshotMagic = 0x47535450; // "GSTP"
+constexpr quint32 kSnapshotVersion = 1;
+
+/// Smallest serialized plugin entry: an empty path (length only), size and modification time
+constexpr qint64 kMinSnapshotEntrySize = sizeof(quint32) + sizeof(qint64) + sizeof(qint64);
+
+QStringList splitSearchPath(const QByteArray& value) {
+    return QString::fromLocal8Bit(value).split(QDir::listSeparator(), Qt::SkipEmptyParts);
+}
+
+} // namespace
+
+QString GstStudio::GstRegistryCache::defaultCacheFilePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/catalog.bin";
+}
+
+QStringList GstStudio::GstRegistryCache::pluginDirectories() {
+    QStringList candidates = splitSearchPath(qgetenv("GST_PLUGIN_PATH_1_0"));
+    candidates += splitSearchPath(qgetenv("GST_PLUGIN_PATH"));
+
+    // An explicit system path replaces the built-in plugin locations, as in GStreamer itself
+    QStringList systemPath = splitSearchPath(qgetenv("GST_PLUGIN_SYSTEM_PATH_1_0"));
+    if (systemPath.isEmpty()) {
+        systemPath = splitSearchPath(qgetenv("GST_PLUGIN_SYSTEM_PATH"));
+    }
+    if (systemPath.isEmpty()) {
+        systemPath << QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) +
+                          "/gstreamer-1.0/plugins";
+#ifdef GSTSTUDIO_GST_PLUGINS_DIR
+        systemPath << QStringLiteral(GSTSTUDIO_GST_PLUGINS_DIR);
+#endif
+        systemPath << "/usr/lib/gstreamer-1.0"
+                   << "/usr/lib64/gstreamer-1.0"
+                   << "/usr/lib/x86_64-linux-gnu/gstreamer-1.0"
+                   << "/usr/lib/aarch64-linux-gnu/gstreamer-1.0"
+                   << "/usr/local/lib/gstreamer-1.0";
+    }
+    candidates += systemPath;
+
+    QStringList directories;
+    for (const QString& candidate : std::as_const(candidates)) {
+        const QString canonical = QFileInfo(candidate).canonicalFilePath();
+        if (!canonical.isEmpty() && QFileInfo(canonical).isDir() && !directories.contains(canonical)) {
+            directories.append(canonical);
+        }
+    }
+    return directories;
+}
+
+QStringList GstStudio::GstRegistryCache::registryFiles() {
+    QStringList files;
+    for (const char* variable : {"GST_REGISTRY_1_0", "GST_REGISTRY"}) {
+        const QString path = QString::fromLocal8Bit(qgetenv(variable));
+        if (!path.isEmpty() && QFileInfo::exists(path)) {
+            files.append(path);
+            return files;
+        }
+    }
+
+    const QDir registryDir(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/gstreamer-1.0");
+    for (const QFileInfo& info : registryDir.entryInfoList({"registry.*.bin"}, QDir::Files, QDir::Name)) {
+        files.append(info.absoluteFilePath());
+    }
+    return files;
+}
+
+GstPluginSnapshot GstStudio::GstRegistryCache::snapshotPluginFiles() {
+    GstPluginSnapshot snapshot;
+    for (const QString& directory : pluginDirectories()) {
+        QDirIterator it(directory, {"*.so", "*.dll", "*.dylib"}, QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            const QFileInfo info = it.nextFileInfo();
+            snapshot.insert(info.absoluteFilePath(),
+                            GstPluginFileStamp{info.size(), info.lastModified().toMSecsSinceEpoch()});
+        }
+    }
+    return snapshot;
+}
+
+QByteArray GstStudio::GstRegistryCache::currentFingerprint() {
+    return fingerprint(snapshotPluginFiles());
+}
+
+QByteArray GstStudio::GstRegistryCache::fingerprint(const GstPluginSnapshot& snapshot) {
+    GstPluginSnapshot stamps = snapshot;
+    for (const QString& file : registryFiles()) {
+        const QFileInfo info(file);
+        stamps.insert(file, GstPluginFileStamp{info.size(), info.lastModified().toMSecsSinceEpoch()});
+    }
+
+    QStringList files = stamps.keys();
+    std::sort(files.begin(), files.end());
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    for (const QString& file : std::as_const(files)) {
+        const GstPluginFileStamp stamp = stamps.value(file);
+        hash.addData(file.toUtf8());
+        hash.addData(QByteArray::number(stamp.m_size));
+        hash.addData(QByteArray::number(stamp.m_modified));
+    }
+    return hash.result();
+}
+
+QString GstStudio::GstRegistryCache::snapshotFilePath(const QString& catalogPath) {
+    return catalogPath + ".plugins";
+}
+
+QString GstStudio::GstRegistryCache::compatibilityGraphFilePath(const QString& catalogPath) {
+    return catalogPath + ".links";
+}
+
+bool GstStudio::GstRegistryCache::loadSnapshot(const QString& path, GstPluginSnapshot& snapshot) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    stream >> magic >> version >> count;
+    if (magic != kSnapshotMagic || version != kSnapshotVersion) {
+        return false;
+    }
+
+    // A corrupt count must not size the hash; more entries than the file can hold means the file is damaged
+    if (count > (file.size() - file.pos()) / kMinSnapshotEntrySize) {
+        return false;
+    }
+
+    GstPluginSnapshot stored;
+    stored.reserve(count);
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString plugin;
+        GstPluginFileStamp stamp;
+        stream >> plugin >> stamp.m_size >> stamp.m_modified;
+        stored.insert(plugin, stamp);
+    }
+    if (stream.status() != QDataStream::Ok) {
+        return false;
+    }
+
+    snapshot = stored;
+    return true;
+}
+
+bool GstStudio::GstRegistryCache::saveSnapshot(const QString& path, const GstPluginSnapshot& snapshot) {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << kSnapshotMagic << kSnapshotVersion << static_cast<quint32>(snapshot.size());
+    for (auto it = snapshot.constBegin(); it != snapshot.constEnd(); ++it) {
+        stream << it.key() << it.value().m_size << it.value().m_modified;
+    }
+    return file.commit();
+}
+
+} // namespace GstStudio
@@ -0,0 +1,116 @@
+/**
+ * @file gstregistrycache.h
+ * @brief Location and invalidation of the on-disk element catalog cache
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace GstStudio {
+
+/**
+ * @struct GstPluginFileStamp
+ * @brief Size and modification time of a plugin file
+ */
+struct GstPluginFileStamp {
+    qint64 m_size = 0;     ///< File size in bytes
+    qint64 m_modified = 0; ///< Modification time in milliseconds since epoch
+
+    bool operator==(const GstPluginFileStamp& other) const {
+        return m_size == other.m_size && m_modified == other.m_modified;
+    }
+
+    bool operator!=(const GstPluginFileStamp& other) const {
+        return !(*this == other);
+    }
+};
+
+/// Plugin file path to stamp, as found in the plugin directories
+using GstPluginSnapshot = QHash<QString, GstPluginFileStamp>;
+
+/**
+ * @class GstRegistryCache
+ * @brief Location and invalidation of the on-disk element catalog cache
+ *
+ * The catalog is stored as a GstMappedCatalog in the user cache directory
+ * together with a fingerprint of the installed GStreamer plugins. The
+ * fingerprint is built from path, size and modification time of every
+ * plugin file and of the GStreamer registry file, so the cache is only
+ * invalidated when plugins are installed, removed or rebuilt.
+ */
+class GstRegistryCache {
+  public:
+    /**
+     * @brief Get the default location of the cache file
+     * @return Absolute path inside the user cache directory
+     */
+    static QString defaultCacheFilePath();
+
+    /**
+     * @brief Get directories GStreamer loads plugins from
+     * @return Existing plugin directories, honouring GST_PLUGIN_PATH and GST_PLUGIN_SYSTEM_PATH
+     */
+    static QStringList pluginDirectories();
+
+    /**
+     * @brief Get the GStreamer registry files of the current user
+     * @return Existing registry file paths
+     */
+    static QStringList registryFiles();
+
+    /**
+     * @brief Stamp every plugin file in the plugin directories
+     * @return Snapshot of the installed plugin files
+     */
+    static GstPluginSnapshot snapshotPluginFiles();
+
+    /**
+     * @brief Compute the fingerprint of the installed plugins
+     * @return Digest over path, size and modification time of all plugin and registry files
+     */
+    static QByteArray currentFingerprint();
+
+    /**
+     * @brief Compute the fingerprint for a plugin snapshot and the current registry files
+     * @param snapshot Snapshot taken with snapshotPluginFiles()
+     * @return Digest over path, size and modification time of all plugin and registry files
+     */
+    static QByteArray fingerprint(const GstPluginSnapshot& snapshot);
+
+    /**
+     * @brief Get the location of the plugin snapshot stored next to a catalog
+     * @param catalogPath Catalog file path
+     * @return Snapshot file path
+     */
+    static QString snapshotFilePath(const QString& catalogPath);
+
+    /**
+     * @brief Get the location of the compatibility graph stored next to a catalog
+     * @param catalogPath Catalog file path
+     * @return Graph file path
+     */
+    static QString compatibilityGraphFilePath(const QString& catalogPath);
+
+    /**
+     * @brief Load a stored plugin snapshot
+     * @param path Snapshot file path
+     * @param snapshot Receives the snapshot on success
+     * @return true if the snapshot was read
+     */
+    static bool loadSnapshot(const QString& path, GstPluginSnapshot& snapshot);
+
+    /**
+     * @brief Store a plugin snapshot
+     * @param path Snapshot file path
+     * @param snapshot Snapshot to store
+     * @return true if the file was written
+     */
+    static bool saveSnapshot(const QString& path, const GstPluginSnapshot& snapshot);
+};
+
+} // namespace GstStudio
@@ -0,0 +1,47 @@
+#include "gstsignalmodel.h"
+
+namespace GstStudio {
+
+GstStudio::GstSignalModel::GstSignalModel(QObject* parent) : QAbstractListModel(parent) {
+}
+
+int GstStudio::GstSignalModel::rowCount(const QModelIndex& parent) const {
+    Q_UNUSED(parent)
+    return static_cast<int>(m_signals.size());
+}
+
+QVariant GstStudio::GstSignalModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_signals.size())
+        return {};
+
+    const GstSignal& descriptor = m_signals.at(index.row());
+
+    switch (role) {
+        case NAME_ROLE:
+            return descriptor.m_name;
+        case KIND_ROLE:
+            return GstSignal::kindName(descriptor.m_kind);
+        case RETURN_TYPE_ROLE:
+            return descriptor.m_returnType;
+        case ARGUMENT_TYPES_ROLE:
+            return descriptor.m_argumentTypes;
+        default:
+            return {};
+    }
+}
+
+QHash<int, QByteArray> GstStudio::GstSignalModel::roleNames() const {
+    QHash<int, QByteArray> roles;
+    roles[NAME_ROLE] = "name";
+    roles[KIND_ROLE] = "kind";
+    roles[RETURN_TYPE_ROLE] = "returnType";
+    roles[ARGUMENT_TYPES_ROLE] = "argumentTypes";
+    return roles;
+}
+
+void GstStudio::GstSignalModel::setSignals(const QList<GstSignal>& descriptors) {
+    // Elements of the same base class, e.g. two bins, keep the rows of their shared signals
+    applyKeyedDiff(*this, m_signals, descriptors);
+}
+
+} // namespace GstStudio
@@ -0,0 +1,84 @@
+/**
+ * @file gstsignalmodel.h
+ * @brief Qt model for displaying GStreamer element signals and actions
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include "gstlistdiff.h"
+#include <QAbstractListModel>
+#include <QQmlEngine>
+
+namespace GstStudio {
+
+/**
+ * @class GstSignalModel
+ * @brief Qt model for displaying GStreamer element signals and actions
+ *
+ * This model provides a QML-accessible interface for displaying the
+ * signals an element emits and the action signals it accepts, in the
+ * order gst-inspect-1.0 lists them.
+ */
+class GstSignalModel : public QAbstractListModel {
+    Q_OBJECT
+    QML_ELEMENT
+
+  public:
+    /**
+     * @enum SignalRoles
+     * @brief Roles for accessing signal data
+     */
+    enum SignalRoles {
+        NAME_ROLE = Qt::UserRole + 1, ///< Signal name
+        KIND_ROLE,                    ///< Signal kind (signal/action)
+        RETURN_TYPE_ROLE,             ///< Return type
+        ARGUMENT_TYPES_ROLE           ///< Argument types as string list
+    };
+
+    /**
+     * @brief Constructs a new GstSignalModel
+     * @param parent Parent QObject
+     */
+    explicit GstSignalModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Get number of signals
+     * @param parent Parent model index (unused)
+     * @return Number of signals and actions
+     */
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    /**
+     * @brief Get data for a specific signal
+     * @param index Model index
+     * @param role Data role
+     * @return QVariant containing requested data
+     */
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Get role names for QML access
+     * @return Hash of role names
+     */
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+    /**
+     * @brief Set signals to display
+     *
+     * Rows are matched by signal name and only changed rows are notified;
+     * the list is shared with the caller, not copied.
+     *
+     * @param descriptors List of signals and actions
+     */
+    void setSignals(const QList<GstSignal>& descriptors);
+
+  private:
+    template <typename Model, typename T>
+    friend void applyKeyedDiff(Model& model, QList<T>& items, const QList<T>& target);
+
+    QList<GstSignal> m_signals; ///< List of signals and actions
+};
+
+} // namespace GstStudio
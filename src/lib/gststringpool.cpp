@@ -0,0 +1,58 @@
+#include "gststringpool.h"
+
+namespace GstStudio {
+
+QString GstStudio::GstStringPool::intern(const QString& text) {
+    if (text.isEmpty()) {
+        return {};
+    }
+
+    {
+        QReadLocker locker(&m_lock);
+        const auto it = m_strings.constFind(text);
+        if (it != m_strings.constEnd()) {
+            return *it;
+        }
+    }
+
+    // Another thread may have added the string in between; insert() keeps the existing copy then
+    QWriteLocker locker(&m_lock);
+    return *m_strings.insert(text);
+}
+
+QString GstStudio::GstStringPool::intern(QStringView text) {
+    return intern(text.toString());
+}
+
+void GstStudio::GstStringPool::internElement(GstElement& element) {
+    element.m_classification = intern(element.m_classification);
+    element.m_pluginName = intern(element.m_pluginName);
+    element.m_pluginFilename = intern(element.m_pluginFilename);
+    element.m_pluginVersion = intern(element.m_pluginVersion);
+    element.m_pluginLicense = intern(element.m_pluginLicense);
+
+    for (GstProperty& property : element.m_properties) {
+        property.m_type = intern(property.m_type);
+        for (QString& value : property.m_enumValues) {
+            value = intern(value);
+        }
+    }
+
+    for (GstPadTemplate& pad : element.m_padTemplates) {
+        pad.m_name = intern(pad.m_name);
+    }
+
+    for (GstSignal& descriptor : element.m_signals) {
+        descriptor.m_returnType = intern(descriptor.m_returnType);
+        for (QString& type : descriptor.m_argumentTypes) {
+            type = intern(type);
+        }
+    }
+}
+
+qsizetype GstStudio::GstStringPool::size() const {
+    QReadLocker locker(&m_lock);
+    return m_strings.size();
+}
+
+} // namespace GstStudio
@@ -0,0 +1,68 @@
+/**
+ * @file gststringpool.h
+ * @brief Pool of interned catalog strings
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include "gstelement.h"
+#include <QReadWriteLock>
+#include <QSet>
+#include <QString>
+#include <QStringView>
+
+namespace GstStudio {
+
+/**
+ * @class GstStringPool
+ * @brief Pool of interned catalog strings
+ *
+ * Type names, enum values, classifications, plugin details and pad names
+ * repeat thousands of times across a catalog. Interning them makes every
+ * occurrence share one implicitly shared buffer, so the catalog costs a
+ * pointer per repetition instead of a separate heap allocation.
+ *
+ * A pool belongs to the catalog it deduplicates and is dropped with it;
+ * the interned strings stay valid, since every copy shares its buffer. The
+ * pool is safe to use from the parser worker threads.
+ */
+class GstStringPool {
+  public:
+    /**
+     * @brief Get the pooled copy of a string, adding it if needed
+     * @param text String to intern
+     * @return String sharing its data with every other interned copy
+     */
+    QString intern(const QString& text);
+
+    /**
+     * @brief Get the pooled copy of a string view, adding it if needed
+     * @param text String to intern
+     * @return String sharing its data with every other interned copy
+     */
+    QString intern(QStringView text);
+
+    /**
+     * @brief Intern the repetitive strings of an element in place
+     *
+     * Covers the classification, plugin details, property and signal
+     * types, enum values and pad template names. Names, descriptions,
+     * defaults, ranges and caps are mostly unique and left alone.
+     *
+     * @param element Element to compact
+     */
+    void internElement(GstElement& element);
+
+    /**
+     * @brief Get number of distinct pooled strings
+     * @return Pool size
+     */
+    [[nodiscard]] qsizetype size() const;
+
+  private:
+    mutable QReadWriteLock m_lock; ///< Guards m_strings against concurrent workers
+    QSet<QString> m_strings;       ///< Distinct interned strings
+};
+
+} // namespace GstStudio
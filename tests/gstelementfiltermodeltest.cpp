@@ -0,0 +1,108 @@
+#include "gstelementfiltermodel.h"
+#include "gstelementlistmodel.h"
+#include <QAbstractItemModelTester>
+#include <QTest>
+
+namespace GstStudio {
+
+/**
+ * @class GstElementFilterModelTest
+ * @brief Checks the rows the element list shows while a search is typed
+ *
+ * The proxy sits on a list model of a few element names; every search
+ * result is applied through setMatches() as the element browser does, and
+ * QAbstractItemModelTester checks the row signals of each change.
+ */
+class GstElementFilterModelTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void init();
+    void cleanup();
+    void matchOrder();
+    void narrowedMatchOrder();
+    void clearMatches();
+
+  private:
+    GstElementListModel* m_source = nullptr;      ///< Element list the proxy filters
+    GstElementFilterModel* m_model = nullptr;     ///< Proxy under test
+    QAbstractItemModelTester* m_tester = nullptr; ///< Checks the proxy signals
+
+    /**
+     * @brief Element names in proxy row order
+     * @return One name per visible row
+     */
+    [[nodiscard]] QStringList rows() const;
+};
+
+void GstStudio::GstElementFilterModelTest::init() {
+    QList<GstElement> elements;
+    for (const char* name : {"appsink", "fakesink", "filesink", "videotestsrc", "vp8dec"}) {
+        GstElement element;
+        element.m_name = QString::fromLatin1(name);
+        elements.append(element);
+    }
+
+    m_source = new GstElementListModel(this);
+    m_source->setElements(elements);
+    m_model = new GstElementFilterModel(this);
+    m_model->setSourceModel(m_source);
+    m_tester = new QAbstractItemModelTester(m_model, QAbstractItemModelTester::FailureReportingMode::QtTest, this);
+}
+
+void GstStudio::GstElementFilterModelTest::cleanup() {
+    delete m_tester;
+    delete m_model;
+    delete m_source;
+}
+
+QStringList GstStudio::GstElementFilterModelTest::rows() const {
+    QStringList names;
+    for (int row = 0; row < m_model->rowCount(); ++row) {
+        names.append(m_model->nameAt(row));
+    }
+    return names;
+}
+
+void GstStudio::GstElementFilterModelTest::matchOrder() {
+    QCOMPARE(rows(), (QStringList{"appsink", "fakesink", "filesink", "videotestsrc", "vp8dec"}));
+
+    const QStringList result{"videotestsrc", "fakesink", "appsink"};
+    m_model->setMatches(result);
+    QCOMPARE(rows(), result);
+}
+
+void GstStudio::GstElementFilterModelTest::narrowedMatchOrder() {
+    m_model->setMatches({"fakesink", "filesink", "vp8dec", "appsink"});
+
+    // Typing on keeps some rows but ranks them differently
+    const QStringList narrowed{"vp8dec", "fakesink"};
+    m_model->setMatches(narrowed);
+    QCOMPARE(rows(), narrowed);
+
+    // New rows have to be placed against the current ranks, not those of the previous result
+    const QStringList widened{"appsink", "vp8dec", "videotestsrc", "fakesink"};
+    m_model->setMatches(widened);
+    QCOMPARE(rows(), widened);
+
+    const QStringList details{"sync"};
+    m_model->setMatches({"fakesink", "appsink"}, {{"fakesink", details}});
+    QCOMPARE(rows(), (QStringList{"fakesink", "appsink"}));
+    QCOMPARE(m_model->index(0, 0).data(GstElementFilterModel::MatchDetailsRole).toStringList(), details);
+    QVERIFY(m_model->index(1, 0).data(GstElementFilterModel::MatchDetailsRole).toStringList().isEmpty());
+}
+
+void GstStudio::GstElementFilterModelTest::clearMatches() {
+    m_model->setMatches({"vp8dec", "appsink"});
+    m_model->clearMatches();
+    QCOMPARE(rows(), (QStringList{"appsink", "fakesink", "filesink", "videotestsrc", "vp8dec"}));
+
+    // A search after the reset sorts by rank again
+    m_model->setMatches({"vp8dec", "filesink"});
+    QCOMPARE(rows(), (QStringList{"vp8dec", "filesink"}));
+}
+
+} // namespace GstStudio
+
+QTEST_GUILESS_MAIN(GstStudio::GstElementFilterModelTest)
+#include "gstelementfiltermodeltest.moc"
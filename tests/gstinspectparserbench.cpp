@@ -0,0 +1,442 @@
+#include "gstcompatibilitygraph.h"
+#include "gstelementindex.h"
+#include "gstinspectparser.h"
+#include "gstinspectsplitter.h"
+#include "gststudiofixtures.h"
+#include <QElapsedTimer>
+#include <QTest>
+#include <algorithm>
+#include <memory>
+
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+#include "gstinspectjobqueue.h"
+#include "gstregistrybackend.h"
+#include <QProcess>
+#endif
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+#define GSTSTUDIO_HAVE_MALLINFO2
+#include <malloc.h>
+#endif
+
+namespace GstStudio {
+
+namespace {
+
+/// Bytes the process holds on the heap, or -1 where the C library does not report it
+qint64 heapInUse() {
+#ifdef GSTSTUDIO_HAVE_MALLINFO2
+    const struct mallinfo2 info = mallinfo2();
+    return static_cast<qint64>(info.uordblks + info.hblkhd);
+#else
+    return -1;
+#endif
+}
+
+/// Corpus sizes as copies of the recording
+constexpr int kCorpusCopies[] = {1, 100, 500};
+
+} // namespace
+
+/**
+ * @class GstInspectParserBench
+ * @brief Throughput and heap benchmarks of the gst-inspect-1.0 parsing stages
+ *
+ * Every stage runs on the recorded --print-all corpus grown to a small,
+ * medium and large element count. Besides the QBENCHMARK timing, one
+ * measured pass per row reports MB/s, time per element and the heap bytes
+ * per element its result holds, taken from mallinfo2() deltas. Heap figures
+ * are only available on glibc 2.33 or later.
+ */
+class GstInspectParserBench : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase();
+    void splitSections_data();
+    void splitSections();
+    void loadOutput_data();
+    void loadOutput();
+    void parseElementDetails_data();
+    void parseElementDetails();
+    void indexSections_data();
+    void indexSections();
+    void parseProperties_data();
+    void parseProperties();
+    void parsePadTemplates_data();
+    void parsePadTemplates();
+    void searchIndex_data();
+    void searchIndex();
+    void findPath_data();
+    void findPath();
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+    void registryBackend();
+    void inspectOutput();
+#endif
+
+  private:
+    QByteArray m_recording; ///< Recorded --print-all output
+
+    /**
+     * @brief Add the corpus columns and the small, medium and large rows
+     */
+    void addCorpusRows() const;
+
+    /**
+     * @brief Element texts of a corpus
+     * @param corpus --print-all output
+     * @return One text per element
+     */
+    static QStringList sectionTexts(const QByteArray& corpus);
+
+    /**
+     * @brief One section of every element of a corpus
+     * @param corpus --print-all output
+     * @param section Section to extract
+     * @return One text per element that has the section
+     */
+    static QStringList sectionTexts(const QByteArray& corpus, GstInspectSectionIndex::Section section);
+
+    /**
+     * @brief Run one pass outside QBENCHMARK and report its throughput and heap use
+     * @param bytes Input size the pass consumes, 0 to leave out MB/s
+     * @param elements Number of elements the pass handles
+     * @param pass Stage to measure, returning its result
+     */
+    template <typename Pass> static void report(qint64 bytes, qsizetype elements, Pass&& pass);
+};
+
+void GstStudio::GstInspectParserBench::initTestCase() {
+    m_recording = Fixtures::load(QStringLiteral("print-all.txt"));
+    QVERIFY(!m_recording.isEmpty());
+}
+
+void GstStudio::GstInspectParserBench::addCorpusRows() const {
+    QTest::addColumn<QByteArray>("corpus");
+    QTest::addColumn<qsizetype>("elements");
+
+    const qsizetype recorded = GstInspectSectionSplitter::split(m_recording).size();
+    for (int copies : kCorpusCopies) {
+        const qsizetype elements = recorded * copies;
+        QTest::addRow("%lld elements", static_cast<long long>(elements))
+            << Fixtures::scaled(m_recording, copies) << elements;
+    }
+}
+
+QStringList GstStudio::GstInspectParserBench::sectionTexts(const QByteArray& corpus) {
+    QStringList texts;
+    for (const GstInspectSection& section : GstInspectSectionSplitter::split(corpus)) {
+        texts.append(section.m_text);
+    }
+    return texts;
+}
+
+QStringList GstStudio::GstInspectParserBench::sectionTexts(const QByteArray& corpus,
+                                                           GstInspectSectionIndex::Section section) {
+    QStringList texts;
+    for (const QString& text : sectionTexts(corpus)) {
+        const QStringView body = GstInspectSectionIndex(text).section(section);
+        if (!body.isEmpty()) {
+            texts.append(body.toString());
+        }
+    }
+    return texts;
+}
+
+template <typename Pass> void GstStudio::GstInspectParserBench::report(qint64 bytes, qsizetype elements, Pass&& pass) {
+    const qint64 heapBefore = heapInUse();
+    QElapsedTimer timer;
+    timer.start();
+
+    // The result stays alive until the heap is measured, so the growth is what the stage output holds
+    const auto result = pass();
+    const qint64 nanoseconds = std::max<qint64>(timer.nsecsElapsed(), 1);
+    const qint64 heapAfter = heapInUse();
+    Q_UNUSED(result)
+
+    const double perElement = 1.0 / std::max<qsizetype>(elements, 1);
+    QString message = QStringLiteral("%1 %2:").arg(QString::fromLatin1(QTest::currentTestFunction()),
+                                                  QString::fromLatin1(QTest::currentDataTag()));
+    if (bytes > 0) {
+        const double megabytesPerSecond = bytes / (1024.0 * 1024.0) / (nanoseconds / 1e9);
+        message += QStringLiteral(" %1 MB/s,").arg(megabytesPerSecond, 0, 'f', 1);
+    }
+    message += QStringLiteral(" %1 us per element").arg(nanoseconds / 1e3 * perElement, 0, 'f', 2);
+    if (heapBefore >= 0) {
+        message += QStringLiteral(", %1 heap bytes per element").arg((heapAfter - heapBefore) * perElement, 0, 'f', 0);
+    }
+    qInfo().noquote() << message;
+}
+
+void GstStudio::GstInspectParserBench::splitSections_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::splitSections() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    report(corpus.size(), elements, [&corpus] { return GstInspectSectionSplitter::split(corpus); });
+    QBENCHMARK {
+        GstInspectSectionSplitter::split(corpus);
+    }
+}
+
+void GstStudio::GstInspectParserBench::loadOutput_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::loadOutput() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    // Headers only, details stay deferred until first access as in the application
+    const auto pass = [&corpus] {
+        auto parser = std::make_unique<GstInspectParser>();
+        parser->setCacheFilePath(QString());
+        parser->loadOutput(corpus);
+        return parser;
+    };
+    report(corpus.size(), elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::parseElementDetails_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::parseElementDetails() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    const QStringList texts = sectionTexts(corpus);
+    const auto pass = [&texts] {
+        QList<GstElement> parsed;
+        parsed.reserve(texts.size());
+        for (const QString& text : texts) {
+            parsed.append(GstInspectParser::Stages::parseElementDetails(text));
+        }
+        return parsed;
+    };
+    report(corpus.size(), elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::indexSections_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::indexSections() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    const QStringList texts = sectionTexts(corpus);
+    const auto pass = [&texts] {
+        qsizetype indexed = 0;
+        for (const QString& text : texts) {
+            indexed += GstInspectSectionIndex(text).section(GstInspectSectionIndex::Section::ElementProperties).size();
+        }
+        return indexed;
+    };
+    report(corpus.size(), elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::parseProperties_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::parseProperties() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    const QStringList texts = sectionTexts(corpus, GstInspectSectionIndex::Section::ElementProperties);
+    const qint64 bytes = texts.join(QString()).toUtf8().size();
+    const auto pass = [&texts] {
+        QList<GstElement> parsed(texts.size());
+        for (qsizetype i = 0; i < texts.size(); ++i) {
+            GstInspectParser::Stages::parseProperties(texts.at(i), parsed[i]);
+        }
+        return parsed;
+    };
+    report(bytes, elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::parsePadTemplates_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::parsePadTemplates() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    const QStringList texts = sectionTexts(corpus, GstInspectSectionIndex::Section::PadTemplates);
+    const qint64 bytes = texts.join(QString()).toUtf8().size();
+    const auto pass = [&texts] {
+        QList<GstElement> parsed(texts.size());
+        for (qsizetype i = 0; i < texts.size(); ++i) {
+            GstInspectParser::Stages::parsePadTemplates(texts.at(i), parsed[i]);
+        }
+        return parsed;
+    };
+    report(bytes, elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::searchIndex_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::searchIndex() {
+    QFETCH(QByteArray, corpus);
+    QFETCH(qsizetype, elements);
+
+    GstElementIndex index;
+    QElapsedTimer timer;
+    timer.start();
+    for (const GstElement& element : GstInspectParser::parseOutput(corpus)) {
+        index.insert(element);
+    }
+    const qint64 insertNanoseconds = timer.nsecsElapsed();
+
+    // One query per keystroke, as the search field sends them; most extend the previous query
+    const QStringList keystrokes{QStringLiteral("v"),         QStringLiteral("vi"),       QStringLiteral("vid"),
+                                 QStringLiteral("vide"),      QStringLiteral("video"),    QStringLiteral("video "),
+                                 QStringLiteral("video d"),   QStringLiteral("video de"), QStringLiteral("video dec"),
+                                 QStringLiteral("vidoe test")};
+    const auto type = [&index, &keystrokes] {
+        qsizetype results = 0;
+        for (const QString& query : keystrokes) {
+            results += index.search(query).size();
+        }
+        return results;
+    };
+    timer.restart();
+    QVERIFY(type() > 0);
+    const qint64 typeNanoseconds = timer.nsecsElapsed();
+    qInfo().noquote() << QStringLiteral("%1 %2: %3 us per element inserted, %4 us per keystroke")
+                             .arg(QString::fromLatin1(QTest::currentTestFunction()),
+                                  QString::fromLatin1(QTest::currentDataTag()))
+                             .arg(insertNanoseconds / 1e3 / std::max<qsizetype>(elements, 1), 0, 'f', 2)
+                             .arg(typeNanoseconds / 1e3 / keystrokes.size(), 0, 'f', 1);
+
+    QBENCHMARK {
+        type();
+    }
+}
+
+void GstStudio::GstInspectParserBench::findPath_data() {
+    addCorpusRows();
+}
+
+void GstStudio::GstInspectParserBench::findPath() {
+    QFETCH(QByteArray, corpus);
+
+    const QList<GstElement> elements = GstInspectParser::parseOutput(corpus);
+    GstCompatibilityGraph graph;
+    graph.build(elements);
+
+    // Larger corpora rename the elements to name-<copy>
+    const auto named = [&elements](QStringView prefix) {
+        const auto found = std::find_if(elements.cbegin(), elements.cend(), [prefix](const GstElement& element) {
+            return element.m_name.startsWith(prefix);
+        });
+        return found == elements.cend() ? QString() : found->m_name;
+    };
+    const QString filesrc = named(u"filesrc");
+    const QString fakesink = named(u"fakesink");
+    const QString videotestsrc = named(u"videotestsrc");
+
+    // Nothing feeds videotestsrc, so that search explores every element filesrc reaches before it gives up
+    constexpr int kBudgetMs = 50;
+    QElapsedTimer timer;
+    timer.start();
+    const QStringList linked = graph.findPath(filesrc, fakesink, kBudgetMs);
+    const qint64 linkedNanoseconds = timer.nsecsElapsed();
+    timer.restart();
+    const QStringList unlinked = graph.findPath(filesrc, videotestsrc, kBudgetMs);
+    const qint64 unlinkedNanoseconds = timer.nsecsElapsed();
+
+    QCOMPARE(linked, (QStringList{filesrc, fakesink}));
+    QVERIFY(unlinked.isEmpty());
+    // The search checks the clock every few elements, so a query never runs much past its budget
+    QVERIFY2(unlinkedNanoseconds / 1000000 < 2 * kBudgetMs, qPrintable(QString::number(unlinkedNanoseconds)));
+    qInfo().noquote() << QStringLiteral("%1 %2: %3 links, %4 us linked, %5 us unlinked, budget %6 ms")
+                             .arg(QString::fromLatin1(QTest::currentTestFunction()),
+                                  QString::fromLatin1(QTest::currentDataTag()))
+                             .arg(graph.linkCount())
+                             .arg(linkedNanoseconds / 1e3, 0, 'f', 1)
+                             .arg(unlinkedNanoseconds / 1e3, 0, 'f', 1)
+                             .arg(kBudgetMs);
+
+    QBENCHMARK {
+        graph.findPath(filesrc, videotestsrc, kBudgetMs);
+    }
+}
+
+#ifdef GSTSTUDIO_HAVE_GST_REGISTRY
+void GstStudio::GstInspectParserBench::registryBackend() {
+    QString errorMessage;
+    if (!GstRegistryBackend::initialize(&errorMessage)) {
+        QSKIP(qPrintable(errorMessage));
+    }
+    const QStringList names = GstRegistryBackend::elementNames(&errorMessage);
+    if (names.isEmpty()) {
+        QSKIP(qPrintable(errorMessage));
+    }
+
+    // Compare with inspectOutput(), which parses the same registry through gst-inspect-1.0
+    const auto pass = [&names] {
+        QList<GstElement> elements;
+        elements.reserve(names.size());
+        for (const QString& name : names) {
+            elements.append(GstRegistryBackend::element(name));
+        }
+        return elements;
+    };
+    report(0, names.size(), pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+
+void GstStudio::GstInspectParserBench::inspectOutput() {
+    // Spawn and parse end to end, in the environment the job queue runs gst-inspect-1.0 with
+    bool finished = false;
+    const auto pass = [&finished] {
+        QProcess process;
+        process.setProcessEnvironment(GstInspectJobQueue::inspectEnvironment());
+        process.setStandardErrorFile(QProcess::nullDevice());
+        process.start(QStringLiteral("gst-inspect-1.0"), {QStringLiteral("--print-all")});
+        finished = process.waitForFinished(60000) && process.exitStatus() == QProcess::NormalExit;
+        return GstInspectParser::parseOutput(process.readAllStandardOutput());
+    };
+
+    // The first run warms the registry and tells the element count; like registryBackend() the
+    // row reports time per element, the output size is not known before a pass
+    const qsizetype elements = pass().size();
+    if (!finished || elements == 0) {
+        QSKIP("gst-inspect-1.0 --print-all did not finish");
+    }
+    report(0, elements, pass);
+    QBENCHMARK {
+        pass();
+    }
+}
+#endif
+
+} // namespace GstStudio
+
+QTEST_GUILESS_MAIN(GstStudio::GstInspectParserBench)
+#include "gstinspectparserbench.moc"
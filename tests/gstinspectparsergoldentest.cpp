@@ -0,0 +1,945 @@
+#include "gstcaps.h"
+#include "gstcapsindex.h"
+#include "gstcatalogdiff.h"
+#include "gstcatalogreader.h"
+#include "gstcatalogwriter.h"
+#include "gstcompatibilitygraph.h"
+#include "gstelementindex.h"
+#include "gstinspectjobqueue.h"
+#include "gstinspectparser.h"
+#include "gstmappedcatalog.h"
+#include "gstpropertyindex.h"
+#include "gstregistrycache.h"
+#include "gststudiofixtures.h"
+#include <QBuffer>
+#include <QCborArray>
+#include <QCborValue>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QScopeGuard>
+#include <QStringTokenizer>
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+#include <cstring>
+
+namespace GstStudio {
+
+/**
+ * @class GstInspectParserGoldenTest
+ * @brief Compares the parse of a recorded --print-all corpus with its expected dump
+ *
+ * tests/fixtures/print-all.golden holds the expected dump of
+ * tests/fixtures/print-all.txt. Run with GSTSTUDIO_UPDATE_GOLDEN=1 to rewrite
+ * it after an intended change of the parser output, and review the diff.
+ *
+ * tests/fixtures/print-all.de.txt is the same recording with the property
+ * flags as gst-inspect-1.0 prints them under a German locale; it must
+ * produce the same dump.
+ */
+class GstInspectParserGoldenTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void initTestCase();
+    void parseOutput();
+    void loadOutput();
+    void localizedOutput_data();
+    void localizedOutput();
+    void inspectEnvironment();
+    void catalogExport();
+    void catalogImport_data();
+    void catalogImport();
+    void catalogDiff();
+    void mappedCatalog();
+    void mappedCatalogDamaged();
+    void registryCache();
+    void elementIndex_data();
+    void elementIndex();
+    void elementIndexTyping();
+    void elementIndexUpdates();
+    void propertyIndex_data();
+    void propertyIndex();
+    void capsCompatibility();
+    void capsIndex_data();
+    void capsIndex();
+    void compatibilityGraph();
+    void compatibilityGraphFile();
+    void findPath();
+
+  private:
+    QByteArray m_corpus; ///< Recorded --print-all output
+    QString m_golden;    ///< Expected dump of m_corpus
+
+    /**
+     * @brief Parse every element of a corpus and dump it
+     * @param corpus --print-all output
+     * @return Dump of all elements in corpus order
+     */
+    static QString dumpCorpus(const QByteArray& corpus);
+
+    /**
+     * @brief Write an element in the golden file format
+     * @param element Parsed element
+     * @return One line per non-empty field
+     */
+    static QString dump(const GstElement& element);
+
+    /**
+     * @brief Compare a dump with the golden file, or replace the golden file if requested
+     * @param actual Dump of the parsed corpus
+     */
+    void compareWithGolden(const QString& actual);
+};
+
+void GstStudio::GstInspectParserGoldenTest::initTestCase() {
+    m_corpus = Fixtures::load(QStringLiteral("print-all.txt"));
+    QVERIFY(!m_corpus.isEmpty());
+    m_golden = QString::fromUtf8(Fixtures::load(QStringLiteral("print-all.golden")));
+}
+
+void GstStudio::GstInspectParserGoldenTest::parseOutput() {
+    compareWithGolden(dumpCorpus(m_corpus));
+}
+
+void GstStudio::GstInspectParserGoldenTest::loadOutput() {
+    // Headers are parsed on the thread pool and details on first access, as in the application
+    GstInspectParser parser;
+    parser.setCacheFilePath(QString());
+    QVERIFY(parser.loadOutput(m_corpus));
+
+    QString actual;
+    for (const QString& name : parser.getAllElementNames()) {
+        actual += dump(parser.getElement(name));
+    }
+    compareWithGolden(actual);
+}
+
+void GstStudio::GstInspectParserGoldenTest::localizedOutput_data() {
+    QTest::addColumn<QString>("fixture");
+    QTest::newRow("C") << QStringLiteral("print-all.txt");
+    QTest::newRow("de_DE") << QStringLiteral("print-all.de.txt");
+}
+
+void GstStudio::GstInspectParserGoldenTest::localizedOutput() {
+    QFETCH(QString, fixture);
+    const QByteArray corpus = Fixtures::load(fixture);
+    QVERIFY(!corpus.isEmpty());
+
+    GstInspectParser parser;
+    parser.setCacheFilePath(QString());
+    QVERIFY(parser.loadOutput(corpus));
+
+    QString actual;
+    for (const QString& name : parser.getAllElementNames()) {
+        actual += dump(parser.getElement(name));
+    }
+
+    // Recorded output goes through loadOutput() as in gststudio-catalog --input; the recording in the C
+    // locale is the reference, and this test never rewrites the golden file
+    QCOMPARE(actual.split(u'\n'), m_golden.split(u'\n'));
+
+    // The flags also reach the property index behind flag: queries
+    GstPropertyIndex index;
+    index.build(GstInspectParser::parseOutput(corpus));
+    QCOMPARE(index.matchingProperties(QStringLiteral("flag:controllable")).value(QStringLiteral("videotestsrc")),
+             QStringList{QStringLiteral("pattern")});
+}
+
+void GstStudio::GstInspectParserGoldenTest::inspectEnvironment() {
+    qputenv("LANGUAGE", "de_DE:en");
+    qputenv("LC_ALL", "de_DE.UTF-8");
+    const QProcessEnvironment environment = GstInspectJobQueue::inspectEnvironment();
+    qunsetenv("LANGUAGE");
+    qunsetenv("LC_ALL");
+
+    const QString locale = environment.value(QStringLiteral("LC_ALL"));
+    QVERIFY2(locale == QStringLiteral("C.UTF-8") || locale == QStringLiteral("C"), qPrintable(locale));
+    QVERIFY(!environment.contains(QStringLiteral("LANGUAGE")));
+    QCOMPARE(environment.value(QStringLiteral("PAGER")), QStringLiteral("cat"));
+    QVERIFY(environment.contains(QStringLiteral("GST_INSPECT_NO_COLORS")));
+}
+
+void GstStudio::GstInspectParserGoldenTest::catalogExport() {
+    GstInspectParser parser;
+    parser.setCacheFilePath(QString());
+    QVERIFY(parser.loadOutput(m_corpus));
+    const QStringList names = parser.getAllElementNames();
+
+    const auto write = [&parser, &names](GstCatalogWriter::Format format) {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        GstCatalogWriter writer(&buffer, format);
+        for (const QString& name : names) {
+            writer.writeElement(parser.getElement(name));
+        }
+        return writer.finish() ? buffer.data() : QByteArray();
+    };
+
+    QJsonParseError error;
+    const QJsonDocument json = QJsonDocument::fromJson(write(GstCatalogWriter::Format::Json), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    const QJsonArray elements = json.object().value(u"elements").toArray();
+    QCOMPARE(elements.size(), names.size());
+
+    // Both encodings carry the same document
+    const QCborValue cbor = QCborValue::fromCbor(write(GstCatalogWriter::Format::Cbor));
+    QCOMPARE(cbor.toMap().toJsonObject(), json.object());
+
+    const QJsonObject appsink = elements.at(names.indexOf(u"appsink")).toObject();
+    QCOMPARE(appsink.value(u"plugin").toObject().value(u"name").toString(), QStringLiteral("app"));
+    const QJsonObject pullSample = appsink.value(u"signals").toArray().at(6).toObject();
+    QCOMPARE(pullSample.value(u"name").toString(), QStringLiteral("pull-sample"));
+    QCOMPARE(pullSample.value(u"kind").toString(), QStringLiteral("action"));
+    QCOMPARE(pullSample.value(u"returnType").toString(), QStringLiteral("GstSample*"));
+}
+
+void GstStudio::GstInspectParserGoldenTest::catalogImport_data() {
+    QTest::addColumn<int>("format");
+    QTest::newRow("json") << static_cast<int>(GstCatalogWriter::Format::Json);
+    QTest::newRow("cbor") << static_cast<int>(GstCatalogWriter::Format::Cbor);
+}
+
+void GstStudio::GstInspectParserGoldenTest::catalogImport() {
+    QFETCH(int, format);
+    const QList<GstElement> elements = GstInspectParser::parseOutput(m_corpus);
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    GstCatalogWriter writer(&buffer, static_cast<GstCatalogWriter::Format>(format));
+    for (const GstElement& element : elements) {
+        writer.writeElement(element);
+    }
+    QVERIFY(writer.finish());
+
+    // A dump read back carries every field of the parse it was written from
+    QList<GstElement> imported;
+    QString errorMessage;
+    QVERIFY2(GstCatalogReader::read(buffer.data(), imported, &errorMessage), qPrintable(errorMessage));
+    QString actual;
+    for (const GstElement& element : std::as_const(imported)) {
+        actual += dump(element);
+    }
+    QCOMPARE(actual, m_golden);
+
+    // Recorded output is recognized as such
+    QVERIFY(GstCatalogReader::read(m_corpus, imported));
+    QCOMPARE(imported.size(), elements.size());
+}
+
+void GstStudio::GstInspectParserGoldenTest::catalogDiff() {
+    const QList<GstElement> before = GstInspectParser::parseOutput(m_corpus);
+    QVERIFY(GstCatalogDiff::compare(before, before).isEmpty());
+
+    QList<GstElement> after = before;
+    const auto find = [&after](QStringView name) {
+        return std::find_if(after.begin(), after.end(),
+                            [name](const GstElement& element) { return element.m_name == name; });
+    };
+
+    GstElement& appsink = *find(u"appsink");
+    appsink.m_properties[0].m_defaultValue = QStringLiteral("true");
+    appsink.m_properties[2].m_range = QStringLiteral("0 - 100");
+    appsink.m_padTemplates[0].m_caps = QStringLiteral("video/x-raw");
+
+    // Fields the comparison does not report leave the fingerprint alone
+    GstElement& fakesink = *find(u"fakesink");
+    const size_t fingerprint = GstCatalogDiff::fingerprint(fakesink);
+    fakesink.m_description = QStringLiteral("Sink discarding all data");
+    QCOMPARE(GstCatalogDiff::fingerprint(fakesink), fingerprint);
+
+    GstElement added = fakesink;
+    added.m_name = QStringLiteral("zzsink");
+    after.prepend(added);
+    after.erase(find(u"vp8dec"));
+
+    using Kind = GstCatalogChange::Kind;
+    const QList<GstCatalogChange> expected = {
+        {Kind::PropertyDefaultChanged, QStringLiteral("appsink"), QStringLiteral("drop"), QStringLiteral("false"),
+         QStringLiteral("true")},
+        {Kind::PropertyRangeChanged, QStringLiteral("appsink"), QStringLiteral("max-buffers"),
+         QStringLiteral("0 - 4294967295"), QStringLiteral("0 - 100")},
+        {Kind::PadCapsChanged, QStringLiteral("appsink"), QStringLiteral("sink"), QStringLiteral("ANY"),
+         QStringLiteral("video/x-raw")},
+        {Kind::ElementRemoved, QStringLiteral("vp8dec")},
+        {Kind::ElementAdded, QStringLiteral("zzsink")}};
+    QCOMPARE(GstCatalogDiff::compare(before, after), expected);
+}
+
+void GstStudio::GstInspectParserGoldenTest::mappedCatalog() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString path = directory.filePath(QStringLiteral("catalog"));
+
+    QMap<QString, GstElement> elements;
+    for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+        elements.insert(element.m_name, element);
+    }
+    QVERIFY(GstMappedCatalog::write(path, QByteArray("plugins-1"), elements));
+
+    GstMappedCatalog catalog;
+    QVERIFY(catalog.open(path));
+    QCOMPARE(catalog.fingerprint(), QByteArray("plugins-1"));
+    QCOMPARE(catalog.elementCount(), static_cast<int>(elements.size()));
+    QCOMPARE(catalog.elementNames(), elements.keys());
+
+    // Every field the parser produced survives the record layout
+    QString actual;
+    for (int i = 0; i < catalog.elementCount(); ++i) {
+        actual += dump(catalog.element(i));
+    }
+    QCOMPARE(actual.split(u'\n'), m_golden.split(u'\n'));
+
+    const int vp8dec = catalog.indexOf(u"vp8dec");
+    QCOMPARE(catalog.elementName(vp8dec).toString(), QStringLiteral("vp8dec"));
+    QCOMPARE(catalog.elementClassification(vp8dec).toString(), QStringLiteral("Codec/Decoder/Video"));
+    QCOMPARE(catalog.indexOf(u"nosuchelement"), -1);
+    QCOMPARE(catalog.indexOf(u"aaa"), -1);
+    QCOMPARE(catalog.elementsByClassification(u"SINK"),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink")}));
+
+    const GstElement header = catalog.elementHeader(catalog.indexOf(u"appsink"));
+    QCOMPARE(header.m_signals, elements.value(QStringLiteral("appsink")).m_signals);
+    QVERIFY(header.m_properties.isEmpty());
+    QVERIFY(header.m_padTemplates.isEmpty());
+    QVERIFY(catalog.element(catalog.elementCount()).m_name.isEmpty());
+
+    catalog.close();
+    QVERIFY(!catalog.isOpen());
+    QCOMPARE(catalog.elementCount(), 0);
+    QVERIFY(!catalog.open(directory.filePath(QStringLiteral("missing"))));
+}
+
+void GstStudio::GstInspectParserGoldenTest::mappedCatalogDamaged() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString path = directory.filePath(QStringLiteral("catalog"));
+
+    QMap<QString, GstElement> elements;
+    for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+        elements.insert(element.m_name, element);
+    }
+    QVERIFY(GstMappedCatalog::write(path, QByteArray("plugins-1"), elements));
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray saved = file.readAll();
+    file.close();
+
+    const auto rewrite = [&path](const QByteArray& content) {
+        QFile damaged(path);
+        return damaged.open(QIODevice::WriteOnly | QIODevice::Truncate) && damaged.write(content) == content.size();
+    };
+    // The header is a run of quint32 fields in native byte order: magic, version, fingerprint offset and
+    // size, then offset and count of each table, ending with the string table
+    const auto withHeaderField = [&saved](int field, quint32 value) {
+        QByteArray content = saved;
+        std::memcpy(content.data() + field * sizeof(quint32), &value, sizeof(value));
+        return content;
+    };
+
+    GstMappedCatalog catalog;
+    QVERIFY(rewrite(saved.left(8)));
+    QVERIFY(!catalog.open(path));
+    QVERIFY(rewrite(saved.left(saved.size() / 2)));
+    QVERIFY(!catalog.open(path));
+    QVERIFY(!catalog.isOpen());
+
+    QVERIFY(rewrite(withHeaderField(0, 0)));
+    QVERIFY2(!catalog.open(path), "magic");
+    QVERIFY(rewrite(withHeaderField(1, 1)));
+    QVERIFY2(!catalog.open(path), "version");
+    QVERIFY(rewrite(withHeaderField(5, 0x7fffffff)));
+    QVERIFY2(!catalog.open(path), "element count");
+    QVERIFY(rewrite(withHeaderField(4, 2)));
+    QVERIFY2(!catalog.open(path), "unaligned elements");
+    QVERIFY(rewrite(withHeaderField(3, static_cast<quint32>(saved.size()))));
+    QVERIFY2(!catalog.open(path), "fingerprint size");
+
+    // References beyond a shortened string table read as empty strings instead of outside the mapping
+    QVERIFY(rewrite(withHeaderField(15, 0)));
+    QVERIFY(catalog.open(path));
+    QCOMPARE(catalog.elementCount(), static_cast<int>(elements.size()));
+    QVERIFY(catalog.element(0).m_name.isEmpty());
+    QVERIFY(catalog.element(0).m_properties.first().m_name.isEmpty());
+    catalog.close();
+}
+
+void GstStudio::GstInspectParserGoldenTest::registryCache() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QDir root(directory.path());
+    QVERIFY(root.mkpath(QStringLiteral("plugins/nested")) && root.mkpath(QStringLiteral("system")));
+    const auto writeFile = [&root](const QString& name, const QByteArray& content) {
+        QFile file(root.filePath(name));
+        return file.open(QIODevice::WriteOnly | QIODevice::Truncate) && file.write(content) == content.size();
+    };
+    QVERIFY(writeFile(QStringLiteral("plugins/libgstfoo.so"), "foo"));
+    QVERIFY(writeFile(QStringLiteral("plugins/nested/libgstbar.so"), "bar"));
+    QVERIFY(writeFile(QStringLiteral("plugins/README"), "not a plugin"));
+    QVERIFY(writeFile(QStringLiteral("registry.bin"), "registry"));
+
+    // An explicit system path keeps the installed plugins out of the test
+    const auto restore = qScopeGuard([] {
+        qunsetenv("GST_PLUGIN_PATH_1_0");
+        qunsetenv("GST_PLUGIN_SYSTEM_PATH_1_0");
+        qunsetenv("GST_REGISTRY_1_0");
+    });
+    qunsetenv("GST_PLUGIN_PATH");
+    qputenv("GST_PLUGIN_PATH_1_0", root.filePath(QStringLiteral("plugins")).toLocal8Bit());
+    qputenv("GST_PLUGIN_SYSTEM_PATH_1_0", root.filePath(QStringLiteral("system")).toLocal8Bit());
+    qputenv("GST_REGISTRY_1_0", root.filePath(QStringLiteral("registry.bin")).toLocal8Bit());
+
+    const QString plugins = QFileInfo(root.filePath(QStringLiteral("plugins"))).canonicalFilePath();
+    QCOMPARE(GstRegistryCache::pluginDirectories(),
+             (QStringList{plugins, QFileInfo(root.filePath(QStringLiteral("system"))).canonicalFilePath()}));
+    QCOMPARE(GstRegistryCache::registryFiles(), QStringList{root.filePath(QStringLiteral("registry.bin"))});
+
+    const GstPluginSnapshot snapshot = GstRegistryCache::snapshotPluginFiles();
+    QStringList files = snapshot.keys();
+    std::sort(files.begin(), files.end());
+    QCOMPARE(files, (QStringList{plugins + QStringLiteral("/libgstfoo.so"),
+                                 plugins + QStringLiteral("/nested/libgstbar.so")}));
+    QCOMPARE(snapshot.value(plugins + QStringLiteral("/libgstfoo.so")).m_size, qint64(3));
+
+    const QByteArray fingerprint = GstRegistryCache::fingerprint(snapshot);
+    QVERIFY(!fingerprint.isEmpty());
+    QCOMPARE(GstRegistryCache::currentFingerprint(), fingerprint);
+
+    // Installing, rebuilding and removing a plugin and a registry update each invalidate the cache
+    QVERIFY(writeFile(QStringLiteral("plugins/libgstnew.so"), "new"));
+    QVERIFY(GstRegistryCache::currentFingerprint() != fingerprint);
+    QVERIFY(QFile::remove(root.filePath(QStringLiteral("plugins/libgstnew.so"))));
+    QCOMPARE(GstRegistryCache::currentFingerprint(), fingerprint);
+
+    QFile rebuilt(root.filePath(QStringLiteral("plugins/nested/libgstbar.so")));
+    QVERIFY(rebuilt.open(QIODevice::ReadWrite));
+    const QDateTime modified = rebuilt.fileTime(QFileDevice::FileModificationTime);
+    QVERIFY(rebuilt.setFileTime(modified.addSecs(60), QFileDevice::FileModificationTime));
+    rebuilt.close();
+    const QByteArray rebuiltFingerprint = GstRegistryCache::currentFingerprint();
+    QVERIFY(rebuiltFingerprint != fingerprint);
+
+    QVERIFY(writeFile(QStringLiteral("registry.bin"), "registry updated"));
+    QVERIFY(GstRegistryCache::currentFingerprint() != rebuiltFingerprint);
+
+    // The snapshot next to a catalog round-trips; damaged files are rejected and leave the output alone
+    const QString catalogPath = root.filePath(QStringLiteral("catalog.bin"));
+    QCOMPARE(GstRegistryCache::snapshotFilePath(catalogPath), catalogPath + QStringLiteral(".plugins"));
+    QCOMPARE(GstRegistryCache::compatibilityGraphFilePath(catalogPath), catalogPath + QStringLiteral(".links"));
+    const QString snapshotPath = GstRegistryCache::snapshotFilePath(catalogPath);
+    QVERIFY(GstRegistryCache::saveSnapshot(snapshotPath, snapshot));
+    GstPluginSnapshot loaded;
+    QVERIFY(GstRegistryCache::loadSnapshot(snapshotPath, loaded));
+    QCOMPARE(loaded, snapshot);
+
+    QFile file(snapshotPath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray saved = file.readAll();
+    file.close();
+    const auto damaged = [&](const QByteArray& content) {
+        GstPluginSnapshot result{{QStringLiteral("kept"), GstPluginFileStamp{1, 1}}};
+        return writeFile(QStringLiteral("catalog.bin.plugins"), content) &&
+               !GstRegistryCache::loadSnapshot(snapshotPath, result) && result.size() == 1;
+    };
+    QVERIFY2(damaged(saved.left(saved.size() - 4)), "truncated");
+    QVERIFY2(damaged(QByteArray(4, '\0') + saved.mid(4)), "magic");
+    // The entry count follows magic and version
+    QVERIFY2(damaged(saved.left(8) + QByteArray(4, '\x7f') + saved.mid(12)), "count");
+    QVERIFY(!GstRegistryCache::loadSnapshot(root.filePath(QStringLiteral("missing")), loaded));
+}
+
+void GstStudio::GstInspectParserGoldenTest::elementIndex_data() {
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<int>("limit");
+    QTest::addColumn<QStringList>("elements");
+    QTest::newRow("empty") << QString() << -1
+                           << QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink"),
+                                          QStringLiteral("filesrc"), QStringLiteral("videotestsrc"),
+                                          QStringLiteral("vp8dec")};
+    QTest::newRow("exact name") << QStringLiteral("FakeSink") << -1 << QStringList{QStringLiteral("fakesink")};
+    // Equal scores rank shorter names first
+    QTest::newRow("name") << QStringLiteral("sink") << -1
+                          << QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink")};
+    QTest::newRow("one letter") << QStringLiteral("v") << -1
+                                << QStringList{QStringLiteral("vp8dec"), QStringLiteral("videotestsrc")};
+    QTest::newRow("limit") << QStringLiteral("s") << 2
+                           << QStringList{QStringLiteral("appsink"), QStringLiteral("filesrc")};
+    // A name match outranks a classification match
+    QTest::newRow("fields") << QStringLiteral("video") << -1
+                            << QStringList{QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")};
+    QTest::newRow("all terms") << QStringLiteral("video dec") << -1 << QStringList{QStringLiteral("vp8dec")};
+    QTest::newRow("description") << QStringLiteral("hole") << -1 << QStringList{QStringLiteral("fakesink")};
+    QTest::newRow("signal") << QStringLiteral("new-sample") << -1 << QStringList{QStringLiteral("appsink")};
+    QTest::newRow("typo") << QStringLiteral("vidoetestsrc") << -1 << QStringList{QStringLiteral("videotestsrc")};
+    QTest::newRow("swapped letters") << QStringLiteral("fakesnik") << -1 << QStringList{QStringLiteral("fakesink")};
+    QTest::newRow("no match") << QStringLiteral("zzzz") << -1 << QStringList();
+}
+
+void GstStudio::GstInspectParserGoldenTest::elementIndex() {
+    QFETCH(QString, query);
+    QFETCH(int, limit);
+    QFETCH(QStringList, elements);
+
+    GstElementIndex index;
+    for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+        index.insert(element);
+    }
+    QCOMPARE(index.size(), 5);
+    QCOMPARE(index.search(query, limit), elements);
+}
+
+void GstStudio::GstInspectParserGoldenTest::elementIndexTyping() {
+    GstElementIndex index;
+    for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+        index.insert(element);
+    }
+
+    // Each query extends the previous one, as while typing; results must match a search from scratch
+    const QStringList queries{QStringLiteral("v"),         QStringLiteral("vi"),       QStringLiteral("vid"),
+                              QStringLiteral("vide"),      QStringLiteral("video"),    QStringLiteral("video "),
+                              QStringLiteral("video d"),   QStringLiteral("video de"), QStringLiteral("video dec"),
+                              QStringLiteral("video decx")};
+    for (const QString& query : queries) {
+        GstElementIndex fresh;
+        for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+            fresh.insert(element);
+        }
+        QCOMPARE(index.search(query), fresh.search(query));
+    }
+
+    // Two letters only match names; the third widens the term to the other fields again
+    QCOMPARE(index.search(QStringLiteral("vi")), QStringList{QStringLiteral("videotestsrc")});
+    QCOMPARE(index.search(QStringLiteral("vid")),
+             (QStringList{QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")}));
+    QCOMPARE(index.search(QStringLiteral("vide")),
+             (QStringList{QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")}));
+
+    // Deleting characters goes back to the posting lists
+    QCOMPARE(index.search(QStringLiteral("video dec")), QStringList{QStringLiteral("vp8dec")});
+    QCOMPARE(index.search(QStringLiteral("video")),
+             (QStringList{QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")}));
+}
+
+void GstStudio::GstInspectParserGoldenTest::elementIndexUpdates() {
+    GstElementIndex index;
+    QList<GstElement> elements = GstInspectParser::parseOutput(m_corpus);
+    for (const GstElement& element : std::as_const(elements)) {
+        index.insert(element);
+    }
+    QCOMPARE(index.search(QStringLiteral("sin")),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink")}));
+
+    GstElement filesink;
+    filesink.m_name = QStringLiteral("filesink");
+    filesink.m_longName = QStringLiteral("File Sink");
+    filesink.m_classification = QStringLiteral("Sink/File");
+    index.insert(filesink);
+    QCOMPARE(index.size(), 6);
+    // The previous matches of a shorter query must not hide the new element
+    QCOMPARE(index.search(QStringLiteral("sink")),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink"), QStringLiteral("filesink")}));
+
+    index.remove(QStringLiteral("appsink"));
+    index.remove(QStringLiteral("nosuchelement"));
+    QCOMPARE(index.size(), 5);
+    QCOMPARE(index.search(QStringLiteral("sink")),
+             (QStringList{QStringLiteral("fakesink"), QStringLiteral("filesink")}));
+    QVERIFY(index.search(QStringLiteral("new-sample")).isEmpty());
+
+    // Replacing an element drops its old text, also across the compactions of repeated updates
+    GstElement fakesink = *std::find_if(elements.cbegin(), elements.cend(),
+                                        [](const GstElement& element) { return element.m_name == u"fakesink"; });
+    for (int update = 0; update < 20; ++update) {
+        fakesink.m_description = QStringLiteral("Discards revision%1").arg(update);
+        index.insert(fakesink);
+    }
+    QCOMPARE(index.size(), 5);
+    QVERIFY(index.search(QStringLiteral("hole")).isEmpty());
+    QCOMPARE(index.search(QStringLiteral("revision19")), QStringList{QStringLiteral("fakesink")});
+    QCOMPARE(index.search(QStringLiteral("fakesink")), QStringList{QStringLiteral("fakesink")});
+
+    index.clear();
+    QCOMPARE(index.size(), 0);
+    QVERIFY(index.search(QString()).isEmpty());
+    QVERIFY(index.search(QStringLiteral("sink")).isEmpty());
+}
+
+void GstStudio::GstInspectParserGoldenTest::propertyIndex_data() {
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<QStringList>("elements");
+    QTest::newRow("empty") << QString() << QStringList();
+    QTest::newRow("name") << QStringLiteral("num-buffers")
+                          << QStringList{QStringLiteral("fakesink"), QStringLiteral("filesrc")};
+    QTest::newRow("name prefix") << QStringLiteral("post-proc") << QStringList{QStringLiteral("vp8dec")};
+    QTest::newRow("flag") << QStringLiteral("FLAG:Controllable") << QStringList{QStringLiteral("videotestsrc")};
+    QTest::newRow("name and type") << QStringLiteral("blocksize type:unsigned")
+                                   << QStringList{QStringLiteral("filesrc"), QStringLiteral("videotestsrc")};
+    // Terms must match the same property: the string property of fakesink is read-only
+    QTest::newRow("type and flag") << QStringLiteral("type:string flag:writable")
+                                   << QStringList{QStringLiteral("filesrc"), QStringLiteral("videotestsrc")};
+    QTest::newRow("no match") << QStringLiteral("latency") << QStringList();
+}
+
+void GstStudio::GstInspectParserGoldenTest::propertyIndex() {
+    QFETCH(QString, query);
+    QFETCH(QStringList, elements);
+
+    GstPropertyIndex index;
+    index.build(GstInspectParser::parseOutput(m_corpus));
+    QCOMPARE(index.search(query), elements);
+
+    const QMap<QString, QStringList> properties = index.matchingProperties(query);
+    QCOMPARE(properties.keys(), elements);
+    for (const QStringList& names : properties) {
+        QVERIFY(!names.isEmpty());
+    }
+    QCOMPARE(index.matchingProperties(QStringLiteral("post-processing")).value(QStringLiteral("vp8dec")),
+             (QStringList{QStringLiteral("post-processing"), QStringLiteral("post-processing-flags")}));
+}
+
+void GstStudio::GstInspectParserGoldenTest::capsCompatibility() {
+    QHash<QString, GstCaps> caps;
+    for (const GstElement& element : GstInspectParser::parseOutput(m_corpus)) {
+        for (const GstPadTemplate& pad : element.m_padTemplates) {
+            caps.insert(element.m_name + u'.' + pad.m_name, GstCaps::parse(pad.m_caps));
+        }
+    }
+
+    QVERIFY(caps.value(QStringLiteral("fakesink.sink")).isAny());
+    QCOMPARE(caps.value(QStringLiteral("videotestsrc.src")).structures().size(), 2);
+    QVERIFY(GstCaps::canIntersect(caps.value(QStringLiteral("videotestsrc.src")),
+                                  caps.value(QStringLiteral("fakesink.sink"))));
+    QVERIFY(GstCaps::canIntersect(caps.value(QStringLiteral("vp8dec.src")),
+                                  caps.value(QStringLiteral("fakesink.sink"))));
+    QVERIFY(!GstCaps::canIntersect(caps.value(QStringLiteral("videotestsrc.src")),
+                                   caps.value(QStringLiteral("vp8dec.sink"))));
+
+    // I420 is in the format list of videotestsrc, framerate ranges overlap
+    const GstCaps i420 = GstCaps::parse(u"video/x-raw\nformat: I420\nframerate: 30/1");
+    QVERIFY(GstCaps::canIntersect(caps.value(QStringLiteral("videotestsrc.src")), i420));
+    const GstCaps p010 = GstCaps::parse(u"video/x-raw\nformat: P010_10LE");
+    QVERIFY(!GstCaps::canIntersect(caps.value(QStringLiteral("videotestsrc.src")), p010));
+    const GstCaps dmabuf = GstCaps::parse(u"video/x-raw(memory:DMABuf)\nformat: I420");
+    QVERIFY(!GstCaps::canIntersect(caps.value(QStringLiteral("vp8dec.src")), dmabuf));
+}
+
+void GstStudio::GstInspectParserGoldenTest::capsIndex_data() {
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<QStringList>("pads");
+    QTest::newRow("empty") << QString() << QStringList();
+    // A structure without a format field accepts every format; vp8dec only produces I420
+    QTest::newRow("string field") << QStringLiteral("video/x-raw, format=NV12")
+                                  << QStringList{QStringLiteral("rawsink.sink"), QStringLiteral("videotestsrc.src")};
+    QTest::newRow("direction") << QStringLiteral("sink video/x-raw, format=NV12")
+                               << QStringList{QStringLiteral("rawsink.sink")};
+    QTest::newRow("ranked") << QStringLiteral("SRC video/x-raw, format=(string)I420")
+                            << QStringList{QStringLiteral("vp8dec.src"), QStringLiteral("videotestsrc.src")};
+    QTest::newRow("features") << QStringLiteral("sink video/x-raw(memory:DMABuf), format=NV12")
+                              << QStringList{QStringLiteral("dmabufsink.sink")};
+    QTest::newRow("features mismatch") << QStringLiteral("video/x-raw(memory:DMABuf), format=I420") << QStringList();
+    QTest::newRow("ranges") << QStringLiteral("video/x-raw, width=1920, framerate=30/1")
+                            << QStringList{QStringLiteral("vp8dec.src"), QStringLiteral("rawsink.sink"),
+                                           QStringLiteral("videotestsrc.src")};
+    QTest::newRow("out of range") << QStringLiteral("video/x-raw, width=0")
+                                  << QStringList{QStringLiteral("rawsink.sink")};
+    QTest::newRow("media type") << QStringLiteral("video/x-vp8") << QStringList{QStringLiteral("vp8dec.sink")};
+    QTest::newRow("presence") << QStringLiteral("request video/x-vp8") << QStringList();
+    QTest::newRow("alternatives") << QStringLiteral("video/x-vp8; video/x-bayer, format=rggb")
+                                  << QStringList{QStringLiteral("vp8dec.sink"), QStringLiteral("videotestsrc.src")};
+}
+
+void GstStudio::GstInspectParserGoldenTest::capsIndex() {
+    QFETCH(QString, query);
+    QFETCH(QStringList, pads);
+
+    const auto sink = [](const QString& name, int rank, const QString& caps) {
+        GstElement element;
+        element.m_name = name;
+        element.m_rank = rank;
+        element.m_padTemplates.append(GstPadTemplate{QStringLiteral("sink"), GstPadTemplate::Direction::Sink,
+                                                     GstPadTemplate::Presence::Always, caps});
+        return element;
+    };
+
+    // The corpus pads with ANY caps are left out of the index
+    QList<GstElement> elements = GstInspectParser::parseOutput(m_corpus);
+    elements.append(sink(QStringLiteral("dmabufsink"), GstElement::RankSecondary,
+                         QStringLiteral("video/x-raw(memory:DMABuf)\nformat: { (string)NV12, (string)P010_10LE }")));
+    elements.append(sink(QStringLiteral("glsink"), GstElement::RankSecondary,
+                         QStringLiteral("video/x-raw(memory:GLMemory)\nformat: RGBA")));
+    elements.append(sink(QStringLiteral("rawsink"), GstElement::RankMarginal, QStringLiteral("video/x-raw")));
+
+    GstCapsIndex index;
+    index.build(elements);
+
+    QStringList actual;
+    for (const GstCapsMatch& match : index.search(query)) {
+        actual.append(match.m_element + u'.' + match.m_padTemplate);
+    }
+    QCOMPARE(actual, pads);
+}
+
+void GstStudio::GstInspectParserGoldenTest::compatibilityGraph() {
+    GstCompatibilityGraph graph;
+    QVERIFY(graph.isEmpty());
+    graph.build(GstInspectParser::parseOutput(m_corpus));
+    QVERIFY(!graph.isEmpty());
+
+    // filesrc produces ANY and feeds every sink pad; the sinks accept ANY; vp8dec only takes video/x-vp8
+    QCOMPARE(graph.linkCount(), 7);
+    QCOMPARE(graph.downstreamElements(QStringLiteral("filesrc")),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink"), QStringLiteral("vp8dec")}));
+    QCOMPARE(graph.downstreamElements(QStringLiteral("videotestsrc")),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink")}));
+    QCOMPARE(graph.downstreamElements(QStringLiteral("vp8dec")),
+             (QStringList{QStringLiteral("appsink"), QStringLiteral("fakesink")}));
+    QVERIFY(graph.downstreamElements(QStringLiteral("fakesink")).isEmpty());
+    QVERIFY(graph.downstreamElements(QStringLiteral("nosuchelement")).isEmpty());
+    QCOMPARE(graph.upstreamElements(QStringLiteral("vp8dec")), QStringList{QStringLiteral("filesrc")});
+    QCOMPARE(graph.upstreamElements(QStringLiteral("fakesink")),
+             (QStringList{QStringLiteral("filesrc"), QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")}));
+
+    const QList<GstPadLink> links = graph.upstreamLinks(QStringLiteral("vp8dec"));
+    QCOMPARE(links.size(), 1);
+    QCOMPARE(links.at(0).m_sourceElement, QStringLiteral("filesrc"));
+    QCOMPARE(links.at(0).m_sourcePad, QStringLiteral("src"));
+    QCOMPARE(links.at(0).m_sinkElement, QStringLiteral("vp8dec"));
+    QCOMPARE(links.at(0).m_sinkPad, QStringLiteral("sink"));
+
+    graph.clear();
+    QVERIFY(graph.isEmpty());
+    QCOMPARE(graph.linkCount(), 0);
+    QVERIFY(graph.downstreamElements(QStringLiteral("filesrc")).isEmpty());
+}
+
+void GstStudio::GstInspectParserGoldenTest::compatibilityGraphFile() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString path = directory.filePath(QStringLiteral("graph"));
+    const QByteArray fingerprint("plugins-1");
+
+    GstCompatibilityGraph built;
+    built.build(GstInspectParser::parseOutput(m_corpus));
+    QVERIFY(built.save(path, fingerprint));
+
+    GstCompatibilityGraph loaded;
+    QVERIFY(loaded.load(path, fingerprint));
+    QCOMPARE(loaded.linkCount(), built.linkCount());
+    for (const char* name : {"appsink", "fakesink", "filesrc", "videotestsrc", "vp8dec"}) {
+        const QString element = QString::fromLatin1(name);
+        QCOMPARE(loaded.downstreamElements(element), built.downstreamElements(element));
+        QCOMPARE(loaded.upstreamElements(element), built.upstreamElements(element));
+    }
+    QCOMPARE(loaded.findPath(QStringLiteral("filesrc"), QStringLiteral("fakesink")),
+             built.findPath(QStringLiteral("filesrc"), QStringLiteral("fakesink")));
+
+    // A graph of other plugins is not loaded, and a failed load keeps the current graph
+    QVERIFY(!loaded.load(path, QByteArray("plugins-2")));
+    QCOMPARE(loaded.linkCount(), built.linkCount());
+    QVERIFY(!loaded.load(directory.filePath(QStringLiteral("missing")), fingerprint));
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray saved = file.readAll();
+    file.close();
+    const auto rewrite = [&path](const QByteArray& content) {
+        QFile damaged(path);
+        return damaged.open(QIODevice::WriteOnly | QIODevice::Truncate) && damaged.write(content) == content.size();
+    };
+
+    GstCompatibilityGraph damaged;
+    QVERIFY(rewrite(saved.left(saved.size() / 2)));
+    QVERIFY(!damaged.load(path, fingerprint));
+    QVERIFY(damaged.isEmpty());
+
+    // The pad count follows the header and the element lists; one the file cannot hold is rejected
+    // before anything is reserved for it
+    QDataStream header(saved);
+    header.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray storedFingerprint;
+    QStringList names;
+    QList<int> ranks;
+    header >> magic >> version >> storedFingerprint >> names >> ranks;
+    QCOMPARE(storedFingerprint, fingerprint);
+    QByteArray corrupted = saved;
+    const qint64 padCount = header.device()->pos();
+    corrupted.replace(padCount, sizeof(quint32), QByteArray(sizeof(quint32), '\xff'));
+    QVERIFY(rewrite(corrupted));
+    QVERIFY(!damaged.load(path, fingerprint));
+    QVERIFY(damaged.isEmpty());
+
+    // A pad of an element that does not exist
+    corrupted = saved;
+    corrupted.replace(padCount + sizeof(quint32), sizeof(qint32), QByteArray(sizeof(qint32), '\x7f'));
+    QVERIFY(rewrite(corrupted));
+    QVERIFY(!damaged.load(path, fingerprint));
+    QVERIFY(damaged.isEmpty());
+}
+
+void GstStudio::GstInspectParserGoldenTest::findPath() {
+    GstCompatibilityGraph graph;
+    graph.build(GstInspectParser::parseOutput(m_corpus));
+    QCOMPARE(graph.findPath(QStringLiteral("videotestsrc"), QStringLiteral("fakesink")),
+             (QStringList{QStringLiteral("videotestsrc"), QStringLiteral("fakesink")}));
+    QCOMPARE(graph.findPath(QStringLiteral("filesrc"), QStringLiteral("vp8dec")),
+             (QStringList{QStringLiteral("filesrc"), QStringLiteral("vp8dec")}));
+    QVERIFY(graph.findPath(QStringLiteral("videotestsrc"), QStringLiteral("vp8dec")).isEmpty());
+    QVERIFY(graph.findPath(QStringLiteral("fakesink"), QStringLiteral("filesrc")).isEmpty());
+    QVERIFY(graph.findPath(QStringLiteral("filesrc"), QStringLiteral("filesrc")).isEmpty());
+    QVERIFY(graph.findPath(QStringLiteral("nosuchelement"), QStringLiteral("fakesink")).isEmpty());
+
+    const auto element = [](const QString& name, int rank, const QString& sinkCaps, const QString& srcCaps) {
+        GstElement result;
+        result.m_name = name;
+        result.m_rank = rank;
+        if (!sinkCaps.isEmpty()) {
+            result.m_padTemplates.append(GstPadTemplate{QStringLiteral("sink"), GstPadTemplate::Direction::Sink,
+                                                        GstPadTemplate::Presence::Always, sinkCaps});
+        }
+        if (!srcCaps.isEmpty()) {
+            result.m_padTemplates.append(GstPadTemplate{QStringLiteral("src"), GstPadTemplate::Direction::Src,
+                                                        GstPadTemplate::Presence::Always, srcCaps});
+        }
+        return result;
+    };
+
+    // identity links audio to video through ANY caps, but elements of rank none are only allowed as the sink
+    QList<GstElement> elements{
+        element(QStringLiteral("audiosrc"), GstElement::RankNone, QString(), QStringLiteral("audio/x-raw")),
+        element(QStringLiteral("identity"), GstElement::RankNone, QStringLiteral("ANY"), QStringLiteral("ANY")),
+        element(QStringLiteral("videosink"), GstElement::RankNone, QStringLiteral("video/x-raw"), QString())};
+    graph.build(elements);
+    QVERIFY(graph.findPath(QStringLiteral("audiosrc"), QStringLiteral("videosink")).isEmpty());
+    QCOMPARE(graph.findPath(QStringLiteral("audiosrc"), QStringLiteral("identity")),
+             (QStringList{QStringLiteral("audiosrc"), QStringLiteral("identity")}));
+
+    // Of two converters the one of higher rank wins, whatever the name order
+    elements.append(element(QStringLiteral("avisualizer"), GstElement::RankMarginal, QStringLiteral("audio/x-raw"),
+                            QStringLiteral("video/x-raw")));
+    elements.append(element(QStringLiteral("zvisualizer"), GstElement::RankPrimary, QStringLiteral("audio/x-raw"),
+                            QStringLiteral("video/x-raw")));
+    graph.build(elements);
+    QCOMPARE(graph.findPath(QStringLiteral("audiosrc"), QStringLiteral("videosink")),
+             (QStringList{QStringLiteral("audiosrc"), QStringLiteral("zvisualizer"), QStringLiteral("videosink")}));
+
+    // A chain of converters, each accepting only the output of the one before
+    const auto chain = [&element](int converters) {
+        const auto caps = [](int step) { return QStringLiteral("application/x-step-%1").arg(step); };
+        QList<GstElement> result;
+        result.append(element(QStringLiteral("chainsrc"), GstElement::RankNone, QString(), caps(0)));
+        result.append(element(QStringLiteral("chainsink"), GstElement::RankNone, caps(converters), QString()));
+        for (int step = 1; step <= converters; ++step) {
+            result.append(element(QStringLiteral("convert-%1").arg(step), GstElement::RankPrimary, caps(step - 1),
+                                  caps(step)));
+        }
+        return result;
+    };
+
+    // Eight elements, counting source and sink, is the longest chain proposed
+    graph.build(chain(6));
+    const QStringList path = graph.findPath(QStringLiteral("chainsrc"), QStringLiteral("chainsink"));
+    QCOMPARE(path.size(), 8);
+    QCOMPARE(path.first(), QStringLiteral("chainsrc"));
+    QCOMPARE(path.at(1), QStringLiteral("convert-1"));
+    QCOMPARE(path.last(), QStringLiteral("chainsink"));
+    graph.build(chain(7));
+    QVERIFY(graph.findPath(QStringLiteral("chainsrc"), QStringLiteral("chainsink")).isEmpty());
+}
+
+QString GstStudio::GstInspectParserGoldenTest::dumpCorpus(const QByteArray& corpus) {
+    QString out;
+    for (const GstElement& element : GstInspectParser::parseOutput(corpus)) {
+        out += dump(element);
+    }
+    return out;
+}
+
+QString GstStudio::GstInspectParserGoldenTest::dump(const GstElement& element) {
+    QString out;
+    const auto field = [&out](QStringView indent, QStringView key, const QString& value) {
+        if (!value.isEmpty()) {
+            out += indent;
+            out += key;
+            out += u": ";
+            out += value;
+            out += u'\n';
+        }
+    };
+
+    out += QStringLiteral("element ") + element.m_name + u'\n';
+    field(u"  ", u"long-name", element.m_longName);
+    field(u"  ", u"klass", element.m_classification);
+    field(u"  ", u"description", element.m_description);
+    field(u"  ", u"author", element.m_author);
+    field(u"  ", u"rank", QString::number(element.m_rank));
+    field(u"  ", u"plugin", element.m_pluginName);
+    field(u"  ", u"filename", element.m_pluginFilename);
+    field(u"  ", u"version", element.m_pluginVersion);
+    field(u"  ", u"license", element.m_pluginLicense);
+    field(u"  ", u"uri", GstElement::uriTypeName(element.m_uriType));
+    field(u"  ", u"protocols", element.m_uriProtocols.join(u", "));
+
+    for (const GstProperty& property : element.m_properties) {
+        out += QStringLiteral("  property ") + property.m_name + u'\n';
+        field(u"    ", u"description", property.m_description);
+        field(u"    ", u"type", property.m_type);
+        field(u"    ", u"range", property.m_range);
+        field(u"    ", u"default", property.m_defaultValue);
+
+        QStringList flags;
+        if (property.isReadable()) {
+            flags.append(QStringLiteral("readable"));
+        }
+        if (property.isWritable()) {
+            flags.append(QStringLiteral("writable"));
+        }
+        if (property.isControllable()) {
+            flags.append(QStringLiteral("controllable"));
+        }
+        field(u"    ", u"flags", flags.join(u' '));
+        field(u"    ", u"values", property.m_enumValues.join(u", "));
+    }
+
+    for (const GstPadTemplate& pad : element.m_padTemplates) {
+        out += QStringLiteral("  pad %1 %2 %3\n")
+                   .arg(pad.m_name, GstPadTemplate::directionName(pad.m_direction),
+                        GstPadTemplate::presenceName(pad.m_presence));
+        for (QStringView line : qTokenize(pad.m_caps, u'\n', Qt::SkipEmptyParts)) {
+            field(u"    ", u"caps", line.toString());
+        }
+    }
+
+    for (const GstSignal& descriptor : element.m_signals) {
+        out += QStringLiteral("  %1 %2\n").arg(GstSignal::kindName(descriptor.m_kind), descriptor.m_name);
+        field(u"    ", u"returns", descriptor.m_returnType);
+        field(u"    ", u"arguments", descriptor.m_argumentTypes.join(u", "));
+    }
+
+    return out;
+}
+
+void GstStudio::GstInspectParserGoldenTest::compareWithGolden(const QString& actual) {
+    if (qEnvironmentVariableIntValue("GSTSTUDIO_UPDATE_GOLDEN") != 0) {
+        QFile file(QStringLiteral(GSTSTUDIO_FIXTURES_DIR "/print-all.golden"));
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(actual.toUtf8());
+        m_golden = actual;
+        return;
+    }
+
+    // Line lists make QCOMPARE report the first differing line
+    QCOMPARE(actual.split(u'\n'), m_golden.split(u'\n'));
+}
+
+} // namespace GstStudio
+
+QTEST_GUILESS_MAIN(GstStudio::GstInspectParserGoldenTest)
+#include "gstinspectparsergoldentest.moc"
@@ -0,0 +1,69 @@
+/**
+ * @file gststudiofixtures.h
+ * @brief Access to the recorded gst-inspect-1.0 corpora used by tests and benchmarks
+ * @author GstStudio Team
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFile>
+#include <QString>
+
+namespace GstStudio::Fixtures {
+
+/**
+ * @brief Read a fixture file
+ * @param name File name inside tests/fixtures
+ * @return File contents, empty if the file cannot be read
+ */
+inline QByteArray load(const QString& name) {
+    QFile file(QStringLiteral(GSTSTUDIO_FIXTURES_DIR "/") + name);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    return file.readAll();
+}
+
+/**
+ * @brief Grow a --print-all corpus by repeating it under distinct element names
+ *
+ * Every copy renames the "elementname:" prefix of each line to
+ * "elementname-<copy>:", so the sections stay distinct elements with the
+ * same content as the recording.
+ *
+ * @param corpus Recorded --print-all output
+ * @param copies Number of copies, 1 returns the corpus unchanged
+ * @return Corpus with copies times as many elements
+ */
+inline QByteArray scaled(const QByteArray& corpus, int copies) {
+    if (copies <= 1) {
+        return corpus;
+    }
+
+    QByteArray result;
+    result.reserve(copies * (corpus.size() + corpus.count('\n') * 6));
+    for (int copy = 0; copy < copies; ++copy) {
+        const QByteArray suffix = '-' + QByteArray::number(copy);
+        qsizetype lineStart = 0;
+        while (lineStart < corpus.size()) {
+            qsizetype lineEnd = corpus.indexOf('\n', lineStart);
+            lineEnd = lineEnd == -1 ? corpus.size() : lineEnd + 1;
+
+            const QByteArrayView line = QByteArrayView(corpus).sliced(lineStart, lineEnd - lineStart);
+            const qsizetype colon = line.indexOf(':');
+            if (colon > 0) {
+                result += line.first(colon);
+                result += suffix;
+                result += line.sliced(colon);
+            } else {
+                result += line;
+            }
+            lineStart = lineEnd;
+        }
+    }
+    return result;
+}
+
+} // namespace GstStudio::Fixtures